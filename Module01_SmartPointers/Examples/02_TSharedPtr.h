@@ -142,6 +142,10 @@ public:
 			MakeShared<FPlayerStats, ESPMode::NotThreadSafe>(TEXT("Fast"));
 
 		// Faster reference counting, but NOT safe to share across threads
+
+		// To choose the mode once per type instead of at every declaration, see 09_SharedPtrPolicies.h:
+		// DECLARE_SHARED_PTR_POLICY(FMyGameThreadData, ESPMode::NotThreadSafe) + TOwnedSharedPtr<FMyGameThreadData>.
+		// TCheckedSharedPtr adds an owner-thread check and per-frame refcount counters in development builds.
 	}
 
 	void PassingToFunctions()
@@ -4,6 +4,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
 
 // Configuration data that should always exist
 struct FGameConfig
@@ -190,16 +193,108 @@ public:
 	// If a factory should always succeed, use TSharedRef
 	static TSharedRef<FGameConfig> LoadOrCreateConfig(const FString& FilePath)
 	{
-		// Try to load
-		if (!FilePath.IsEmpty())
+		// Try to load - parsed once per file, later loads copy the cached result
+		if (TSharedPtr<const FGameConfig, ESPMode::ThreadSafe> Parsed = FindOrParseConfig(FilePath))
 		{
-			// Load logic here...
-			return MakeShared<FGameConfig>();
+			return MakeShared<FGameConfig>(*Parsed);  // Caller's own copy - edits don't leak into the cache
 		}
 
 		// Fall back to default - always returns valid config
 		return CreateDefaultConfig();
 	}
+
+	// Read-only callers can share the cached config without copying it
+	static TSharedRef<const FGameConfig, ESPMode::ThreadSafe> LoadConfigSnapshot(const FString& FilePath)
+	{
+		if (TSharedPtr<const FGameConfig, ESPMode::ThreadSafe> Parsed = FindOrParseConfig(FilePath))
+		{
+			return Parsed.ToSharedRef();
+		}
+		return MakeShared<FGameConfig, ESPMode::ThreadSafe>(*CreateDefaultConfig());
+	}
+
+private:
+	struct FCachedConfig
+	{
+		TSharedRef<const FGameConfig, ESPMode::ThreadSafe> Config;
+		FDateTime TimeStamp;
+	};
+
+	struct FConfigCache
+	{
+		FCriticalSection Lock;
+		TMap<FString, FCachedConfig> Entries;
+	};
+
+	static FConfigCache& GetCache()
+	{
+		static FConfigCache* Instance = new FConfigCache();
+		return *Instance;
+	}
+
+	// Cached by path; a file whose timestamp changed is parsed again. Null if it can't be read.
+	static TSharedPtr<const FGameConfig, ESPMode::ThreadSafe> FindOrParseConfig(const FString& FilePath)
+	{
+		if (FilePath.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*FilePath);
+		if (TimeStamp == FDateTime::MinValue())
+		{
+			return nullptr;  // Missing
+		}
+
+		FConfigCache& Cache = GetCache();
+		{
+			FScopeLock Lock(&Cache.Lock);
+			const FCachedConfig* Cached = Cache.Entries.Find(FilePath);
+			if (Cached && Cached->TimeStamp == TimeStamp)
+			{
+				return Cached->Config;
+			}
+		}
+
+		// Read and parse outside the lock - two threads loading the same new file both parse, one result wins
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *FilePath))
+		{
+			return nullptr;
+		}
+
+		TSharedRef<const FGameConfig, ESPMode::ThreadSafe> Parsed = MakeShared<FGameConfig, ESPMode::ThreadSafe>(ParseConfig(Text));
+
+		FScopeLock Lock(&Cache.Lock);
+		Cache.Entries.Add(FilePath, FCachedConfig{Parsed, TimeStamp});
+		return Parsed;
+	}
+
+	// "Key=Value" lines; unknown keys are ignored, missing keys keep their defaults
+	static FGameConfig ParseConfig(const FString& Text)
+	{
+		FGameConfig Config;
+
+		TArray<FString> Lines;
+		Text.ParseIntoArrayLines(Lines);
+		for (const FString& Line : Lines)
+		{
+			FString Key, Value;
+			if (!Line.Split(TEXT("="), &Key, &Value))
+			{
+				continue;
+			}
+			Key.TrimStartAndEndInline();
+			Value.TrimStartAndEndInline();
+
+			if (Key == TEXT("MasterVolume"))          { Config.MasterVolume = FCString::Atof(*Value); }
+			else if (Key == TEXT("MouseSensitivity")) { Config.MouseSensitivity = FCString::Atof(*Value); }
+			else if (Key == TEXT("bInvertY"))         { Config.bInvertY = Value.ToBool(); }
+			else if (Key == TEXT("PlayerName"))       { Config.PlayerName = Value; }
+		}
+
+		return Config;
+	}
 };
 
 // Real-world example: Subsystem with guaranteed dependencies
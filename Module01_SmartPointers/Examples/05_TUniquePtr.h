@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "10_BufferedFileWriter.h"
 
 // Simple resource class
 class FFileHandle
@@ -42,31 +43,81 @@ public:
 	}
 };
 
+enum class EFileWriteMode : uint8
+{
+	Immediate,  // Every line goes straight to the handle
+	Buffered    // Lines collect in pages written to disk by a background task (see 10_BufferedFileWriter.h)
+};
+
 // Example 1: RAII Pattern
 class FFileWriter
 {
 private:
+	// Exactly one sink is set: the handle (Immediate) or the buffered writer (Buffered)
 	TUniquePtr<FFileHandle> FileHandle;
+	TUniquePtr<FBufferedFileWriter> BufferedWriter;
 
 public:
-	explicit FFileWriter(const FString& FileName)
-		: FileHandle(MakeUnique<FFileHandle>(FileName))
+	explicit FFileWriter(const FString& FileName, EFileWriteMode Mode = EFileWriteMode::Immediate, int32 BufferSize = 64 * 1024)
 	{
 		// File automatically opened in constructor
+		if (Mode == EFileWriteMode::Buffered)
+		{
+			FBufferedFileWriterSettings Settings;
+			Settings.PageSize = BufferSize;
+			BufferedWriter = FBufferedFileWriter::Open(FileName, Settings);
+			if (!BufferedWriter)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Could not open %s for buffered writing - writing lines immediately instead"), *FileName);
+			}
+		}
+
+		if (!BufferedWriter)
+		{
+			FileHandle = MakeUnique<FFileHandle>(FileName);
+		}
 	}
 
 	// Destructor automatically closes file via TUniquePtr
+	// (buffered mode: the writer's destructor flushes the remaining data first)
 	~FFileWriter() = default;
 
 	void WriteLine(const FString& Line)
 	{
-		if (FileHandle)
+		if (BufferedWriter)
+		{
+			BufferedWriter->WriteLine(Line);
+		}
+		else if (FileHandle)
 		{
 			FileHandle->Write(Line);
 		}
 	}
 
-	// Move semantics example
+	// Buffered mode formats on the stack instead of building an FString
+	template<typename FormatType, typename... ArgTypes>
+	void WriteLinef(const FormatType& Format, ArgTypes... Args)
+	{
+		if (BufferedWriter)
+		{
+			BufferedWriter->WriteLinef(Format, Args...);
+		}
+		else
+		{
+			WriteLine(FString::Printf(Format, Args...));
+		}
+	}
+
+	// Barrier: in buffered mode, returns once everything written so far is in the file
+	void Flush()
+	{
+		if (BufferedWriter)
+		{
+			BufferedWriter->Flush();
+		}
+	}
+
+	// Move semantics example - the buffered writer itself stays put, only the pointer moves
 	FFileWriter(FFileWriter&& Other) = default;
 	FFileWriter& operator=(FFileWriter&& Other) = default;
 
@@ -264,6 +315,15 @@ public:
 		}  // File automatically closed here - no manual cleanup!
 
 		UE_LOG(LogTemp, Log, TEXT("File has been closed automatically"));
+
+		{
+			// Same RAII guarantee, without blocking on every line
+			FFileWriter BufferedLog(FPaths::ProjectSavedDir() / TEXT("buffered.txt"), EFileWriteMode::Buffered, 16 * 1024);
+			for (int32 i = 0; i < 1000; i++)
+			{
+				BufferedLog.WriteLinef(TEXT("Line %d"), i);
+			}
+		}  // Remaining page flushed and file closed here
 	}
 
 	void MoveSemantics()
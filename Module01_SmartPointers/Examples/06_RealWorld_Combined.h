@@ -5,6 +5,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "07_ConcurrentObservers.h"
+#include "09_SharedPtrPolicies.h"
+#include "12_VersionedConfigStore.h"
+#include "../../Module02_TaskSystem/Examples/10_GameThreadHandoff.h"
+#include "../../Module02_TaskSystem/Examples/16_BackgroundJobSubsystem.h"
+#include <atomic>
 #include "06_RealWorld_Combined.generated.h"
 
 // Non-UObject data structures - use smart pointers
@@ -55,21 +61,35 @@ struct FGameplayConfig
 	}
 };
 
+// Stats are only touched on the game thread - non-atomic reference counts for every
+// pointer to them, held through checked pointers so any off-thread use fails a check
+// and the refcount traffic shows up in FSharedRefCountStats (see 09_SharedPtrPolicies.h).
+// Config is read from worker jobs too, so it lives in a versioned store of immutable
+// snapshots (see 12_VersionedConfigStore.h).
+DECLARE_SHARED_PTR_POLICY(FPlayerStats, ESPMode::NotThreadSafe);
+
 // Game systems using appropriate pointer types
 
+// One player (or a few) - for crowds of NPCs, use a handle into FStatsWorld instead (see 11_BatchedStatsWorld.h)
 class FStatsSystem
 {
 private:
-	TSharedRef<FGameplayConfig> Config;  // Always needs valid config
-	TSharedPtr<FPlayerStats> Stats;       // Shared with other systems
+	TConfigView<FGameplayConfig> Config;  // Always valid - this frame's config snapshot
+	TCheckedSharedPtr<FPlayerStats> Stats; // Shared with other systems
 
 public:
-	FStatsSystem(TSharedRef<FGameplayConfig> InConfig, TSharedPtr<FPlayerStats> InStats)
-		: Config(InConfig)
+	FStatsSystem(TConfigStoreRef<FGameplayConfig> ConfigStore, TCheckedSharedPtr<FPlayerStats> InStats)
+		: Config(ConfigStore)
 		, Stats(InStats)
 	{
 	}
 
+	// Picks up config published since the last call - once per frame
+	void RefreshConfig()
+	{
+		Config.Refresh();
+	}
+
 	void ApplyDamage(int32 Damage)
 	{
 		if (Stats.IsValid())
@@ -86,17 +106,35 @@ public:
 	{
 		if (Stats.IsValid() && Stats->Health < Stats->MaxHealth)
 		{
-			int32 RegenAmount = Config->HealthRegenRate * DeltaTime;
-			Stats->Health = FMath::Min(Stats->MaxHealth, Stats->Health + RegenAmount);
+			ApplyRegen(ComputeRegen(Config->HealthRegenRate, DeltaTime));
 		}
 	}
+
+	// Pure - no shared state, safe on a worker thread
+	static int32 ComputeRegen(float RegenRate, float Seconds)
+	{
+		return FMath::FloorToInt(RegenRate * Seconds);
+	}
+
+	void ApplyRegen(int32 Amount)
+	{
+		if (Stats.IsValid())
+		{
+			Stats->Health = FMath::Min(Stats->MaxHealth, Stats->Health + Amount);
+		}
+	}
+
+	float GetRegenRate() const
+	{
+		return Config->HealthRegenRate;
+	}
 };
 
 class FInventorySystem
 {
 private:
 	TUniquePtr<FInventoryData> Inventory;  // Exclusive ownership
-	TWeakPtr<FPlayerStats> PlayerStats;     // Optional reference, no ownership
+	TCheckedWeakPtr<FPlayerStats> PlayerStats;   // Optional reference, no ownership
 
 public:
 	FInventorySystem()
@@ -104,7 +142,7 @@ public:
 	{
 	}
 
-	void SetPlayerStats(TSharedPtr<FPlayerStats> Stats)
+	void SetPlayerStats(TCheckedSharedPtr<FPlayerStats> Stats)
 	{
 		PlayerStats = Stats;
 	}
@@ -125,7 +163,7 @@ public:
 		}
 
 		// Use weak pointer to access stats
-		if (TSharedPtr<FPlayerStats> Stats = PlayerStats.Pin())
+		if (TCheckedSharedPtr<FPlayerStats> Stats = PlayerStats.Pin())
 		{
 			Stats->Health = FMath::Min(Stats->MaxHealth, Stats->Health + 50);
 			Inventory->Items.RemoveAt(PotionIndex);
@@ -150,11 +188,25 @@ public:
 };
 
 // Observer pattern for UI updates
+
+// Which stats changed - observers register for the fields they display
+enum class EStatsField : uint8
+{
+	None = 0,
+	Health = 1 << 0,
+	MaxHealth = 1 << 1,
+	Stamina = 1 << 2,
+	All = Health | MaxHealth | Stamina
+};
+ENUM_CLASS_FLAGS(EStatsField);
+
 class IStatsObserver
 {
 public:
 	virtual ~IStatsObserver() = default;
-	virtual void OnStatsChanged(const FPlayerStats& Stats) = 0;
+
+	// ChangedFields is every field that changed since the last notification
+	virtual void OnStatsChanged(const FPlayerStats& Stats, EStatsField ChangedFields) = 0;
 };
 
 class FStatsUIWidget : public IStatsObserver
@@ -167,56 +219,129 @@ public:
 	{
 	}
 
-	void OnStatsChanged(const FPlayerStats& Stats) override
+	void OnStatsChanged(const FPlayerStats& Stats, EStatsField ChangedFields) override
 	{
 		UE_LOG(LogTemp, Log, TEXT("[%s] HP: %d/%d | Stamina: %.1f"),
 			*WidgetName, Stats.Health, Stats.MaxHealth, Stats.Stamina);
 	}
 };
 
-class FObservableStats
+enum class EStatsNotifyMode : uint8
+{
+	Immediate,          // Every change notifies right away, on the thread that made it
+	Deferred,           // Changes accumulate; Flush() sends one notification (once per frame from Tick)
+	GameThreadBatched   // Changes from any thread accumulate; one flush per frame runs on the game thread
+};
+
+/*
+ * In Deferred and GameThreadBatched modes, a frame with dozens of stat changes produces
+ * ONE notification per observer, carrying the union of the changed fields. Observers
+ * registered for fields that didn't change aren't called at all.
+ *
+ * The observer list is a TConcurrentObserverList (see 07_ConcurrentObservers.h):
+ * observers can be added and changes marked from task threads, and notifying takes a
+ * lock-free snapshot. Dead observers are compacted lazily once enough have been seen.
+ *
+ * GameThreadBatched is for simulation tasks that produce stat changes. FPlayerStats is
+ * NotThreadSafe, so tasks never write it: they hand each change to the game thread through
+ * FGameThreadHandoffQueue (Module 2, example 10), where ModifyHealth/ModifyStamina apply
+ * it. The first change after a flush queues one flush on the same queue; later changes
+ * only set bits until it runs, so the UI is notified once per frame however many tasks
+ * reported. See AGameplayManager::StartPoison.
+ *
+ * ModifyHealth, ModifyStamina and Flush are game thread only. AddObserver and MarkDirty
+ * may be called from any thread.
+ */
+class FObservableStats : public TSharedFromThis<FObservableStats>
 {
 private:
-	TSharedPtr<FPlayerStats> Stats;
-	TArray<TWeakPtr<IStatsObserver>> Observers;  // Weak - don't keep UI alive
+	TCheckedSharedPtr<FPlayerStats> Stats;
+	TConcurrentObserverList<IStatsObserver> Observers;
+	EStatsNotifyMode NotifyMode;
+	std::atomic<uint8> DirtyFields{0};  // EStatsField bits, set from any thread
 
 public:
-	explicit FObservableStats(TSharedPtr<FPlayerStats> InStats)
+	explicit FObservableStats(TCheckedSharedPtr<FPlayerStats> InStats, EStatsNotifyMode InNotifyMode = EStatsNotifyMode::Immediate)
 		: Stats(InStats)
+		, NotifyMode(InNotifyMode)
 	{
 	}
 
-	void AddObserver(TWeakPtr<IStatsObserver> Observer)
+	// Any thread
+	void AddObserver(TWeakPtr<IStatsObserver> Observer, EStatsField InterestMask = EStatsField::All)
 	{
-		Observers.Add(Observer);
+		Observers.Add(MoveTemp(Observer), static_cast<uint32>(InterestMask));
 	}
 
+	// Game thread only - Stats is a checked NotThreadSafe pointer
 	void ModifyHealth(int32 Delta)
 	{
 		if (Stats.IsValid())
 		{
+			const int32 OldHealth = Stats->Health;
 			Stats->Health = FMath::Clamp(Stats->Health + Delta, 0, Stats->MaxHealth);
-			NotifyObservers();
+
+			if (Stats->Health != OldHealth)
+			{
+				MarkDirty(EStatsField::Health);
+			}
 		}
 	}
 
-	void NotifyObservers()
+	// Game thread only
+	void ModifyStamina(float Delta)
 	{
-		// Clean up dead observers
-		Observers.RemoveAll([](const TWeakPtr<IStatsObserver>& Weak)
+		if (Stats.IsValid() && Delta != 0.0f)
 		{
-			return !Weak.IsValid();
-		});
+			Stats->Stamina = FMath::Max(0.0f, Stats->Stamina + Delta);
+			MarkDirty(EStatsField::Stamina);
+		}
+	}
+
+	// For changes made directly to the shared FPlayerStats by other systems. Any thread.
+	void MarkDirty(EStatsField Fields)
+	{
+		const uint8 WasDirty = DirtyFields.fetch_or(static_cast<uint8>(Fields));
 
-		// Notify living observers
-		for (TWeakPtr<IStatsObserver>& WeakObserver : Observers)
+		if (NotifyMode == EStatsNotifyMode::Immediate)
+		{
+			Flush();
+		}
+		else if (NotifyMode == EStatsNotifyMode::GameThreadBatched && WasDirty == 0)
 		{
-			if (TSharedPtr<IStatsObserver> Observer = WeakObserver.Pin())
+			// Only the first change since the last flush queues a callback
+			TWeakPtr<FObservableStats> WeakThis = AsShared();
+			FGameThreadHandoffQueue::Get().Enqueue([WeakThis]()
 			{
-				Observer->OnStatsChanged(*Stats);
-			}
+				if (TSharedPtr<FObservableStats> This = WeakThis.Pin())
+				{
+					This->Flush();
+				}
+			});
 		}
 	}
+
+	// Treat every field as changed
+	void NotifyObservers()
+	{
+		MarkDirty(EStatsField::All);
+	}
+
+	// Sends one notification for everything marked dirty since the last flush
+	void Flush()
+	{
+		const EStatsField ChangedFields = static_cast<EStatsField>(DirtyFields.exchange(0));
+		if (ChangedFields == EStatsField::None || !Stats.IsValid())
+		{
+			return;
+		}
+
+		// Observers that display none of the changed fields are skipped
+		Observers.ForEach(static_cast<uint32>(ChangedFields), [this, ChangedFields](IStatsObserver& Observer)
+		{
+			Observer.OnStatsChanged(*Stats, ChangedFields);
+		});
+	}
 };
 
 // UObject Actor that ties it all together
@@ -226,24 +351,32 @@ class AGameplayManager : public AActor
 	GENERATED_BODY()
 
 private:
-	// Shared configuration across all systems
-	TSharedRef<FGameplayConfig> Config;
+	// Shared configuration across all systems - published as immutable snapshots
+	TConfigStoreRef<FGameplayConfig> ConfigStore;
 
 	// Shared player stats
-	TSharedPtr<FPlayerStats> PlayerStats;
+	TCheckedSharedPtr<FPlayerStats> PlayerStats;
 
 	// Individual systems with appropriate ownership
 	TUniquePtr<FStatsSystem> StatsSystem;
 	TUniquePtr<FInventorySystem> InventorySystem;
 	TSharedPtr<FObservableStats> ObservableStats;
+	TSharedPtr<FObservableStats> PoisonStats;  // GameThreadBatched view fed by worker tasks
+
+	// Stand-in for the UI that owns its widgets - observers only hold weak references
+	TArray<TSharedPtr<FStatsUIWidget>> Widgets;
 
 	// UObject references for Unreal objects
 	UPROPERTY()
 	TObjectPtr<AActor> PlayerActor;
 
+	// Regen time not yet turned into health, and whether a regen job is queued
+	float PendingRegenSeconds = 0.0f;
+	bool bRegenJobInFlight = false;
+
 public:
 	AGameplayManager()
-		: Config(MakeShared<FGameplayConfig>())  // Create shared config
+		: ConfigStore(MakeConfigStore<FGameplayConfig>())  // Create shared config
 	{
 		PrimaryActorTick.bCanEverTick = true;
 	}
@@ -253,21 +386,24 @@ public:
 		Super::BeginPlay();
 
 		// Initialize shared stats
-		PlayerStats = MakeShared<FPlayerStats>();
+		PlayerStats = MakeCheckedShared<FPlayerStats>();
 
 		// Create systems with appropriate pointer types
-		StatsSystem = MakeUnique<FStatsSystem>(Config, PlayerStats);
+		StatsSystem = MakeUnique<FStatsSystem>(ConfigStore, PlayerStats);
 		InventorySystem = MakeUnique<FInventorySystem>();
 		InventorySystem->SetPlayerStats(PlayerStats);
 
-		// Create observable stats for UI
-		ObservableStats = MakeShared<FObservableStats>(PlayerStats);
+		// Create observable stats for UI - deferred: changes are coalesced and flushed once per Tick
+		ObservableStats = MakeShared<FObservableStats>(PlayerStats, EStatsNotifyMode::Deferred);
 
 		// Simulate UI widgets observing stats
 		TSharedPtr<FStatsUIWidget> HealthBar = MakeShared<FStatsUIWidget>(TEXT("HealthBar"));
 		TSharedPtr<FStatsUIWidget> StatusPanel = MakeShared<FStatsUIWidget>(TEXT("StatusPanel"));
+		Widgets.Add(HealthBar);
+		Widgets.Add(StatusPanel);
 
-		ObservableStats->AddObserver(HealthBar);
+		// The health bar only cares about health - stamina changes skip it entirely
+		ObservableStats->AddObserver(HealthBar, EStatsField::Health | EStatsField::MaxHealth);
 		ObservableStats->AddObserver(StatusPanel);
 
 		// Initial setup
@@ -278,20 +414,28 @@ public:
 		// Test damage
 		UE_LOG(LogTemp, Log, TEXT("=== Taking Damage ==="));
 		StatsSystem->ApplyDamage(30);
-		ObservableStats->NotifyObservers();
+		ObservableStats->MarkDirty(EStatsField::Health);
 
 		// Test potion
 		UE_LOG(LogTemp, Log, TEXT("=== Using Health Potion ==="));
 		InventorySystem->UseHealthPotion();
-		ObservableStats->NotifyObservers();
+		ObservableStats->MarkDirty(EStatsField::Health);
 
 		// Demonstrate config changes affect all systems
 		UE_LOG(LogTemp, Log, TEXT("=== Enabling Hardcore Mode ==="));
-		Config->DamageMultiplier = 2.0f;
-		Config->bHardcoreMode = true;
+		ConfigStore->Update([](FGameplayConfig& Next)
+		{
+			Next.DamageMultiplier = 2.0f;
+			Next.bHardcoreMode = true;  // One publish - no reader sees one change without the other
+		});
 
+		StatsSystem->RefreshConfig();  // Normally picked up at the start of the next Tick
 		StatsSystem->ApplyDamage(20);  // Now does 40 damage
-		ObservableStats->NotifyObservers();
+		ObservableStats->MarkDirty(EStatsField::Health);
+
+		// All three changes above arrive as one notification in the first Tick
+
+		StartPoison(HealthBar);
 	}
 
 	void Tick(float DeltaTime) override
@@ -299,19 +443,120 @@ public:
 		Super::Tick(DeltaTime);
 
 		// Systems can access shared data
-		if (StatsSystem)
+		if (StatsSystem && PlayerStats.IsValid())
 		{
-			StatsSystem->RegenerateHealth(DeltaTime);
+			StatsSystem->RefreshConfig();
+
+			UBackgroundJobSubsystem* Jobs = GetWorld() ? GetWorld()->GetSubsystem<UBackgroundJobSubsystem>() : nullptr;
+			if (Jobs)
+			{
+				SubmitRegenJob(*Jobs, DeltaTime);
+			}
+			else
+			{
+				const int32 OldHealth = PlayerStats->Health;
+				StatsSystem->RegenerateHealth(DeltaTime);
+
+				if (PlayerStats->Health != OldHealth)
+				{
+					ObservableStats->MarkDirty(EStatsField::Health);
+				}
+			}
+		}
+
+		// One notification per frame, however many changes were made
+		if (ObservableStats)
+		{
+			ObservableStats->Flush();
 		}
 	}
+
+private:
+	// Damage over time computed on workers. Each task hands its hit to the game thread,
+	// where it's applied; GameThreadBatched turns every hit that lands in one frame into a
+	// single health bar notification.
+	void StartPoison(const TSharedPtr<FStatsUIWidget>& Observer)
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Poisoned (worker-side simulation) ==="));
+
+		PoisonStats = MakeShared<FObservableStats>(PlayerStats, EStatsNotifyMode::GameThreadBatched);
+		PoisonStats->AddObserver(Observer, EStatsField::Health);
+
+		const TWeakPtr<FObservableStats> WeakPoison = PoisonStats;
+		for (int32 Dose = 0; Dose < 4; Dose++)
+		{
+			UE::Tasks::Launch(TEXT("PoisonTick"), [WeakPoison, Dose]()
+			{
+				const int32 Damage = 2 + Dose % 2;  // Stand-in for a resistance calculation
+
+				// Worker thread - never touch FPlayerStats here
+				FGameThreadHandoffQueue::Get().Enqueue([WeakPoison, Damage]()
+				{
+					if (TSharedPtr<FObservableStats> Poison = WeakPoison.Pin())
+					{
+						Poison->ModifyHealth(-Damage);  // Game thread; queues one flush for all doses
+					}
+				});
+			});
+		}
+	}
+
+	// Regen as a low priority background job (see 16_BackgroundJobSubsystem.h). With hundreds of
+	// managers, the completions share the world's per-frame budget instead of all running in Tick.
+	// Time accumulates while a job is queued, so a deferred completion loses no regen.
+	// At full health nothing accumulates - banked time would heal the next hit instantly.
+	void SubmitRegenJob(UBackgroundJobSubsystem& Jobs, float DeltaTime)
+	{
+		if (PlayerStats->Health >= PlayerStats->MaxHealth)
+		{
+			if (!bRegenJobInFlight)
+			{
+				PendingRegenSeconds = 0.0f;
+			}
+			return;
+		}
+
+		PendingRegenSeconds += DeltaTime;
+		if (bRegenJobInFlight)
+		{
+			return;
+		}
+
+		const float RegenRate = StatsSystem->GetRegenRate();
+		const float Seconds = PendingRegenSeconds;
+		if (FStatsSystem::ComputeRegen(RegenRate, Seconds) <= 0)
+		{
+			return;  // Not a whole point banked yet - a job now would spend a MaxJobsInFlight slot on nothing
+		}
+		bRegenJobInFlight = true;
+
+		Jobs.Submit(this, EBackgroundJobPriority::Low,
+			[RegenRate, Seconds]()
+			{
+				return FStatsSystem::ComputeRegen(RegenRate, Seconds);  // Worker thread - values only
+			},
+			[RegenRate](AGameplayManager& Manager, int32&& Amount)
+			{
+				Manager.bRegenJobInFlight = false;
+				if (Amount <= 0 || !Manager.StatsSystem)
+				{
+					return;
+				}
+
+				// Consume only the time that produced whole points; the remainder carries over
+				Manager.PendingRegenSeconds = FMath::Max(0.0f, Manager.PendingRegenSeconds - Amount / RegenRate);
+				Manager.StatsSystem->ApplyRegen(Amount);
+				Manager.ObservableStats->MarkDirty(EStatsField::Health);
+			});
+	}
 };
 
 // Summary of pointer usage in this example:
 //
-// TSharedRef<FGameplayConfig>: Config always needed, shared across systems
-// TSharedPtr<FPlayerStats>: Stats shared between multiple systems
+// TConfigStoreRef<FGameplayConfig>: Config always needed, shared across systems and threads as immutable snapshots
+// TCheckedSharedPtr<FPlayerStats>: Stats shared between multiple systems, game thread only (checked)
 // TUniquePtr<FInventoryData>: Inventory exclusively owned by InventorySystem
 // TUniquePtr<FStatsSystem>: System exclusively owned by manager
-// TWeakPtr<IStatsObserver>: UI observers don't prevent UI deletion
-// TWeakPtr<FPlayerStats>: Inventory has optional reference to stats
+// TWeakPtr<IStatsObserver>: UI observers don't prevent UI deletion (dead ones compacted lazily)
+// TCheckedWeakPtr<FPlayerStats>: Inventory has optional reference to stats
 // TObjectPtr<AActor>: UObject reference (Unreal's GC system)
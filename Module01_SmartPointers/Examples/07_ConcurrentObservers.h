@@ -0,0 +1,402 @@
+// Example 7: Concurrent Observer Lists
+// Copy-on-write snapshots so observers can be notified from any thread without a lock
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+/*
+ * A plain TArray<TWeakPtr<FObserver>> is only safe on one thread. Putting a mutex around
+ * it makes every notification contend with every other notification.
+ *
+ * TRcuPtr<T> (read-copy-update) keeps the current value behind an atomic pointer:
+ * - Readers take a snapshot with Read(): one atomic increment, no lock, no waiting.
+ *   The snapshot stays valid until the read scope ends, even if a writer replaces it.
+ * - Writers copy the current value, modify the copy and publish it with one atomic
+ *   exchange. Writers serialize among themselves, but never wait for readers.
+ * - Replaced values are retired, and freed once every reader that could still see them
+ *   has finished. Reader registrations are split into two epochs (even/odd): a retired
+ *   value is freed after the epoch has advanced twice, and the epoch only advances when
+ *   the older epoch has no readers left.
+ *
+ * Good fit: read constantly, written rarely - observer lists, config, lookup tables.
+ * Bad fit: written every frame - each write copies the whole value.
+ *
+ * NOTE: Keep read scopes short. A reader that never leaves its scope stops retired values
+ * from being freed (they pile up; nothing breaks). Writes from inside a read scope are
+ * fine - the writer doesn't wait, so an observer can unregister itself while notified.
+ *
+ * TConcurrentObserverList builds on it: Add/Remove from any thread, ForEach takes a
+ * snapshot and calls every live observer. Dead observers are counted as they are found
+ * and compacted by the next writer (or opportunistically, if nobody is writing).
+ */
+template<typename T>
+class TRcuPtr
+{
+public:
+	explicit TRcuPtr(T InitialValue = T())
+		: Current(new T(MoveTemp(InitialValue)))
+	{
+	}
+
+	// No readers may be active - delete whatever is left
+	~TRcuPtr()
+	{
+		delete Current.load();
+		for (const FRetired& Item : Retired)
+		{
+			delete Item.Value;
+		}
+	}
+
+	TRcuPtr(const TRcuPtr&) = delete;
+	TRcuPtr& operator=(const TRcuPtr&) = delete;
+
+	// A consistent snapshot for the lifetime of the scope
+	class FReadScope
+	{
+	public:
+		explicit FReadScope(const TRcuPtr& InOwner)
+			: Owner(InOwner)
+		{
+			// Register in the current epoch. If a writer advanced it in between, retry -
+			// a registration is only good if the epoch didn't move while we made it.
+			for (;;)
+			{
+				const uint64 Epoch = Owner.Epoch.load();
+				Slot = static_cast<int32>(Epoch & 1);
+				Owner.ActiveReaders[Slot].fetch_add(1);
+
+				if (Owner.Epoch.load() == Epoch)
+				{
+					break;
+				}
+				Owner.ActiveReaders[Slot].fetch_sub(1);
+			}
+
+			Value = Owner.Current.load();
+		}
+
+		~FReadScope()
+		{
+			Owner.ActiveReaders[Slot].fetch_sub(1);
+		}
+
+		FReadScope(const FReadScope&) = delete;
+		FReadScope& operator=(const FReadScope&) = delete;
+
+		const T& Get() const { return *Value; }
+		const T& operator*() const { return *Value; }
+		const T* operator->() const { return Value; }
+
+	private:
+		const TRcuPtr& Owner;
+		const T* Value;
+		int32 Slot;
+	};
+
+	FReadScope Read() const
+	{
+		return FReadScope(*this);
+	}
+
+	// Copy, modify, publish. Mutate runs under the writer lock - keep it short.
+	template<typename FuncType>
+	void Update(FuncType&& Mutate)
+	{
+		FScopeLock Lock(&WriteLock);
+		T* Next = new T(*Current.load());
+		Mutate(*Next);
+		PublishLocked(Next);
+	}
+
+	// Same as Update, but gives up instead of waiting if another writer holds the lock
+	template<typename FuncType>
+	bool TryUpdate(FuncType&& Mutate)
+	{
+		if (!WriteLock.TryLock())
+		{
+			return false;
+		}
+
+		T* Next = new T(*Current.load());
+		Mutate(*Next);
+		PublishLocked(Next);
+
+		WriteLock.Unlock();
+		return true;
+	}
+
+	void Set(T NewValue)
+	{
+		FScopeLock Lock(&WriteLock);
+		PublishLocked(new T(MoveTemp(NewValue)));
+	}
+
+	// Frees retired values whose readers have finished. Writes do this too.
+	void Reclaim()
+	{
+		FScopeLock Lock(&WriteLock);
+		ReclaimLocked();
+	}
+
+	int32 NumRetired() const
+	{
+		FScopeLock Lock(&WriteLock);
+		return Retired.Num();
+	}
+
+private:
+	struct FRetired
+	{
+		T* Value;
+		uint64 Epoch;  // Epoch when it was replaced
+	};
+
+	void PublishLocked(T* Next)
+	{
+		T* Previous = Current.exchange(Next);
+		Retired.Add(FRetired{Previous, Epoch.load()});
+		ReclaimLocked();
+	}
+
+	void ReclaimLocked()
+	{
+		// Advancing at most twice frees everything retired so far when nobody is reading
+		TryAdvanceEpochLocked();
+		TryAdvanceEpochLocked();
+
+		const uint64 Now = Epoch.load();
+		for (int32 i = Retired.Num() - 1; i >= 0; i--)
+		{
+			// Two advances since retirement: every reader that could see it has finished
+			if (Now >= Retired[i].Epoch + 2)
+			{
+				delete Retired[i].Value;
+				Retired.RemoveAtSwap(i);
+			}
+		}
+	}
+
+	void TryAdvanceEpochLocked()
+	{
+		// Only advance once the previous epoch's readers are gone - its counter is about to be reused
+		const uint64 Now = Epoch.load();
+		if (ActiveReaders[(Now + 1) & 1].load() == 0)
+		{
+			Epoch.store(Now + 1);
+		}
+	}
+
+	std::atomic<T*> Current;
+	std::atomic<uint64> Epoch{0};
+	mutable std::atomic<int32> ActiveReaders[2] = {{0}, {0}};
+
+	mutable FCriticalSection WriteLock;
+	TArray<FRetired> Retired;  // Guarded by WriteLock
+};
+
+// Weak observer list, safe to add to, remove from and notify from any thread
+template<typename ObserverType>
+class TConcurrentObserverList
+{
+public:
+	// Compact once this many dead entries have been seen (or a quarter of the list, if larger)
+	static constexpr int32 MinDeadBeforeCompact = 8;
+
+	// InterestMask is matched against the mask passed to ForEach - 0 bits in common skips the observer
+	void Add(TWeakPtr<ObserverType> Observer, uint32 InterestMask = MAX_uint32)
+	{
+		Entries.Update([&Observer, InterestMask](FEntryArray& Array)
+		{
+			RemoveDead(Array);
+			Array.Add(FEntry{MoveTemp(Observer), InterestMask});
+		});
+		NumDeadSeen.store(0, std::memory_order_relaxed);
+	}
+
+	void Remove(const ObserverType* Observer)
+	{
+		Entries.Update([Observer](FEntryArray& Array)
+		{
+			Array.RemoveAll([Observer](const FEntry& Entry)
+			{
+				return !Entry.Observer.IsValid() || Entry.Observer.HasSameObject(Observer);
+			});
+		});
+		NumDeadSeen.store(0, std::memory_order_relaxed);
+	}
+
+	// Calls Func(Observer) for every live observer interested in Mask. Lock-free.
+	template<typename FuncType>
+	void ForEach(uint32 Mask, FuncType&& Func) const
+	{
+		int32 NumDead = 0;
+		int32 NumEntries = 0;
+		{
+			typename TRcuPtr<FEntryArray>::FReadScope Snapshot = Entries.Read();
+			NumEntries = Snapshot->Num();
+
+			for (const FEntry& Entry : *Snapshot)
+			{
+				if ((Entry.InterestMask & Mask) == 0)
+				{
+					continue;
+				}
+
+				if (TSharedPtr<ObserverType> Observer = Entry.Observer.Pin())
+				{
+					Func(*Observer);
+				}
+				else
+				{
+					NumDead++;
+				}
+			}
+		}
+
+		if (NumDead > 0)
+		{
+			MaybeCompact(NumDead, NumEntries);
+		}
+	}
+
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		ForEach(MAX_uint32, Forward<FuncType>(Func));
+	}
+
+	// Includes dead entries not yet compacted
+	int32 Num() const
+	{
+		return Entries.Read()->Num();
+	}
+
+private:
+	struct FEntry
+	{
+		TWeakPtr<ObserverType> Observer;
+		uint32 InterestMask;
+	};
+
+	using FEntryArray = TArray<FEntry>;
+
+	static void RemoveDead(FEntryArray& Array)
+	{
+		Array.RemoveAll([](const FEntry& Entry)
+		{
+			return !Entry.Observer.IsValid();
+		});
+	}
+
+	// Lazy and non-blocking: only once enough dead entries were seen, and only if no writer is busy
+	void MaybeCompact(int32 NumDead, int32 NumEntries) const
+	{
+		const int32 Seen = NumDeadSeen.fetch_add(NumDead, std::memory_order_relaxed) + NumDead;
+		if (Seen < FMath::Max(MinDeadBeforeCompact, NumEntries / 4))
+		{
+			return;
+		}
+
+		if (Entries.TryUpdate([](FEntryArray& Array) { RemoveDead(Array); }))
+		{
+			NumDeadSeen.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	mutable TRcuPtr<FEntryArray> Entries;
+	mutable std::atomic<int32> NumDeadSeen{0};
+};
+
+// Example usage
+class FConcurrentObserverExamples
+{
+public:
+	struct FProgressListener
+	{
+		FString Name;
+		std::atomic<int32> NumUpdates{0};
+
+		explicit FProgressListener(const FString& InName) : Name(InName) {}
+		void OnProgress(int32 Step) { NumUpdates++; }
+	};
+
+	// Example 1: Publish from many tasks while observers come and go
+	void PublishFromTasks()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Concurrent Observers: Publish From Tasks ==="));
+
+		TConcurrentObserverList<FProgressListener> Listeners;
+		TSharedPtr<FProgressListener> Hud = MakeShared<FProgressListener>(TEXT("Hud"));
+		TSharedPtr<FProgressListener> Minimap = MakeShared<FProgressListener>(TEXT("Minimap"));
+		Listeners.Add(Hud);
+		Listeners.Add(Minimap);
+
+		TArray<UE::Tasks::FTask> Tasks;
+		for (int32 TaskIdx = 0; TaskIdx < 8; TaskIdx++)
+		{
+			Tasks.Add(UE::Tasks::Launch(TEXT("Simulate"), [&Listeners, TaskIdx]()
+			{
+				for (int32 Step = 0; Step < 1000; Step++)
+				{
+					// Snapshot + notify - no lock, publishers never wait on each other
+					Listeners.ForEach([Step](FProgressListener& Listener)
+					{
+						Listener.OnProgress(Step);
+					});
+				}
+
+				// Registration from a task is fine too
+				if (TaskIdx == 0)
+				{
+					Listeners.Add(MakeShared<FProgressListener>(TEXT("Temporary")));  // Dies immediately, compacted later
+				}
+			}));
+		}
+
+		UE::Tasks::Wait(Tasks);
+		UE_LOG(LogTemp, Log, TEXT("Hud received %d updates, Minimap received %d"), Hud->NumUpdates.load(), Minimap->NumUpdates.load());
+	}
+
+	// Example 2: TRcuPtr on its own - a table read by many, replaced occasionally
+	void SnapshotTable()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Concurrent Observers: RCU Table ==="));
+
+		TRcuPtr<TMap<FName, float>> DamageTable(TMap<FName, float>{{TEXT("Sword"), 10.0f}});
+
+		{
+			TRcuPtr<TMap<FName, float>>::FReadScope Table = DamageTable.Read();
+
+			// A writer publishes a new table while we still read the old one - no waiting either way
+			DamageTable.Update([](TMap<FName, float>& Next) { Next.Add(TEXT("Axe"), 14.0f); });
+
+			UE_LOG(LogTemp, Log, TEXT("Old snapshot still has %d entries"), Table->Num());
+		}
+
+		DamageTable.Reclaim();
+		UE_LOG(LogTemp, Log, TEXT("New snapshot has %d entries, %d retired"), DamageTable.Read()->Num(), DamageTable.NumRetired());
+	}
+
+	// Example 3: WRONG - iterating a shared TArray while other threads add to it
+	void UnsafeObserverListAntiPattern()
+	{
+		/* DON'T DO THIS:
+		TArray<TWeakPtr<FObserver>> Observers;   // Shared with task threads
+		ParallelFor(NumTasks, [&](int32 i)
+		{
+			Observers.Add(NewObserver);            // Reallocates while another task iterates
+			for (TWeakPtr<FObserver>& Weak : Observers) { ... }
+		});
+		*/
+
+		// DO THIS:
+		// TConcurrentObserverList<FObserver> Observers;
+		// Observers.Add(NewObserver);            // Copy-on-write
+		// Observers.ForEach([](FObserver& Observer) { ... });  // Snapshot, lock-free
+	}
+};
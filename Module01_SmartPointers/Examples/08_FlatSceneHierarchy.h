@@ -0,0 +1,429 @@
+// Example 8: Flat Scene Hierarchy
+// Parent indices in contiguous arrays instead of a tree of shared pointers
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "04_TWeakPtr.h"
+#include <atomic>
+
+/*
+ * FSceneNode (04_TWeakPtr.h) is the textbook ownership tree: children held by TSharedPtr,
+ * parent by TWeakPtr. It's correct, but every walk pays for it:
+ * - GetRoot() calls Pin() per level - an atomic increment and decrement each time
+ * - PrintHierarchy() recurses through pointers to nodes scattered across the heap
+ * With 100k+ nodes, traversal is a cache miss per node.
+ *
+ * FFlatSceneHierarchy stores the same tree as parallel arrays indexed by node:
+ *   Parents[i]        - parent index, INDEX_NONE for roots
+ *   SubtreeSizes[i]   - nodes are in depth-first order, so i's subtree is [i, i + SubtreeSizes[i])
+ *   Depths[i], Names[i], LocalTransforms[i], WorldTransforms[i]
+ *
+ * - Walking up is integer loads; walking the whole tree is a linear scan
+ * - LevelOrder lists the nodes grouped by depth. Transform propagation runs one depth
+ *   level at a time: every node in a level only reads its parent's world transform,
+ *   which the previous level already computed, so a level runs as one ParallelFor.
+ * - Dirty tracking: MarkDirty(i) flags one node. During propagation a node is recomputed
+ *   if it or its parent was recomputed, so only changed branches do transform math -
+ *   everything else costs a byte compare.
+ *
+ * Ownership no longer comes from the pointers: the hierarchy owns all nodes, and a node
+ * is an index. Indices are stable until the hierarchy is rebuilt.
+ */
+
+// Input for Build - Parent is an index into the same desc array, and must come before the child
+struct FSceneNodeDesc
+{
+	FName Name;
+	int32 Parent = INDEX_NONE;
+	FTransform LocalTransform = FTransform::Identity;
+};
+
+class FFlatSceneHierarchy
+{
+public:
+	// Depth levels smaller than this are updated inline - not worth waking workers
+	static constexpr int32 MinParallelLevelSize = 2048;
+
+	// Reorders the descs depth-first. OutDescToNode (optional) maps desc index -> node index.
+	static FFlatSceneHierarchy Build(TConstArrayView<FSceneNodeDesc> Descs, TArray<int32>* OutDescToNode = nullptr)
+	{
+		const int32 NumNodes = Descs.Num();
+
+		// Child lists as first-child / next-sibling links, in desc order
+		TArray<int32> FirstChild;
+		TArray<int32> NextSibling;
+		FirstChild.Init(INDEX_NONE, NumNodes);
+		NextSibling.Init(INDEX_NONE, NumNodes);
+
+		TArray<int32> Roots;
+		for (int32 DescIdx = NumNodes - 1; DescIdx >= 0; DescIdx--)
+		{
+			const int32 Parent = Descs[DescIdx].Parent;
+			checkf(Parent < DescIdx, TEXT("Parents must come before their children"));
+
+			if (Parent == INDEX_NONE)
+			{
+				Roots.Insert(DescIdx, 0);
+			}
+			else
+			{
+				NextSibling[DescIdx] = FirstChild[Parent];
+				FirstChild[Parent] = DescIdx;
+			}
+		}
+
+		FFlatSceneHierarchy Hierarchy;
+		Hierarchy.Allocate(NumNodes);
+
+		TArray<int32> DescToNode;
+		DescToNode.SetNumUninitialized(NumNodes);
+
+		// Iterative pre-order walk - no recursion, so deep chains can't overflow the stack
+		TArray<int32> Stack;
+		for (int32 RootIdx = Roots.Num() - 1; RootIdx >= 0; RootIdx--)
+		{
+			Stack.Push(Roots[RootIdx]);
+		}
+
+		int32 NextNode = 0;
+		while (Stack.Num() > 0)
+		{
+			const int32 DescIdx = Stack.Pop();
+			const FSceneNodeDesc& Desc = Descs[DescIdx];
+			const int32 Node = NextNode++;
+
+			DescToNode[DescIdx] = Node;
+			Hierarchy.Names[Node] = Desc.Name;
+			Hierarchy.LocalTransforms[Node] = Desc.LocalTransform;
+			Hierarchy.Parents[Node] = Desc.Parent == INDEX_NONE ? INDEX_NONE : DescToNode[Desc.Parent];
+			Hierarchy.Depths[Node] = Desc.Parent == INDEX_NONE ? 0 : Hierarchy.Depths[Hierarchy.Parents[Node]] + 1;
+
+			// Push in reverse so the first child is visited first
+			TArray<int32, TInlineAllocator<16>> Children;
+			for (int32 Child = FirstChild[DescIdx]; Child != INDEX_NONE; Child = NextSibling[Child])
+			{
+				Children.Add(Child);
+			}
+			for (int32 ChildIdx = Children.Num() - 1; ChildIdx >= 0; ChildIdx--)
+			{
+				Stack.Push(Children[ChildIdx]);
+			}
+		}
+
+		Hierarchy.BuildDerivedData();
+
+		if (OutDescToNode)
+		{
+			*OutDescToNode = MoveTemp(DescToNode);
+		}
+		return Hierarchy;
+	}
+
+	// Flattens an FSceneNode tree - names only, transforms start at identity
+	static FFlatSceneHierarchy FromSceneNode(const FSceneNode& Root)
+	{
+		TArray<FSceneNodeDesc> Descs;
+		TArray<TPair<const FSceneNode*, int32>> Pending;
+		Pending.Add({&Root, INDEX_NONE});
+
+		while (Pending.Num() > 0)
+		{
+			const TPair<const FSceneNode*, int32> Item = Pending.Pop();
+			const int32 DescIdx = Descs.Add(FSceneNodeDesc{FName(*Item.Key->NodeName), Item.Value});
+
+			for (int32 ChildIdx = Item.Key->Children.Num() - 1; ChildIdx >= 0; ChildIdx--)
+			{
+				if (const FSceneNode* Child = Item.Key->Children[ChildIdx].Get())
+				{
+					Pending.Add({Child, DescIdx});
+				}
+			}
+		}
+
+		return Build(Descs);
+	}
+
+	int32 Num() const { return Parents.Num(); }
+	int32 GetParent(int32 Node) const { return Parents[Node]; }
+	int32 GetDepth(int32 Node) const { return Depths[Node]; }
+	int32 GetSubtreeSize(int32 Node) const { return SubtreeSizes[Node]; }
+	FName GetName(int32 Node) const { return Names[Node]; }
+	int32 GetNumLevels() const { return LevelOffsets.Num() - 1; }
+
+	// Integer walk - no Pin(), no refcount traffic
+	int32 GetRoot(int32 Node) const
+	{
+		while (Parents[Node] != INDEX_NONE)
+		{
+			Node = Parents[Node];
+		}
+		return Node;
+	}
+
+	bool IsDescendantOf(int32 Node, int32 Ancestor) const
+	{
+		return Node > Ancestor && Node < Ancestor + SubtreeSizes[Ancestor];
+	}
+
+	// Direct children of Node, in order - skips over each child's subtree
+	template<typename FuncType>
+	void ForEachChild(int32 Node, FuncType&& Func) const
+	{
+		const int32 End = Node + SubtreeSizes[Node];
+		for (int32 Child = Node + 1; Child < End; Child += SubtreeSizes[Child])
+		{
+			Func(Child);
+		}
+	}
+
+	// Linear scan in depth-first order - same output as FSceneNode::PrintHierarchy
+	void PrintHierarchy() const
+	{
+		for (int32 Node = 0; Node < Num(); Node++)
+		{
+			const FString Indent = FString::ChrN(Depths[Node] * 2, ' ');
+			UE_LOG(LogTemp, Log, TEXT("%s- %s"), *Indent, *Names[Node].ToString());
+		}
+	}
+
+	const FTransform& GetLocalTransform(int32 Node) const { return LocalTransforms[Node]; }
+	const FTransform& GetWorldTransform(int32 Node) const { return WorldTransforms[Node]; }
+
+	// World transforms of Node and its subtree are recomputed by the next UpdateWorldTransforms
+	void SetLocalTransform(int32 Node, const FTransform& Transform)
+	{
+		LocalTransforms[Node] = Transform;
+		MarkDirty(Node);
+	}
+
+	void MarkDirty(int32 Node)
+	{
+		Dirty[Node] = 1;
+		bAnyDirty = true;
+	}
+
+	// Recomputes world transforms of dirty branches, one depth level at a time.
+	// Returns the number of nodes recomputed.
+	int32 UpdateWorldTransforms()
+	{
+		if (!bAnyDirty)
+		{
+			return 0;
+		}
+
+		std::atomic<int32> NumUpdated{0};
+
+		for (int32 Level = 0; Level < GetNumLevels(); Level++)
+		{
+			const int32 LevelStart = LevelOffsets[Level];
+			const int32 LevelSize = LevelOffsets[Level + 1] - LevelStart;
+
+			// Parents are all in the previous level, which is finished - no races inside a level
+			auto UpdateNode = [this, LevelStart](int32 LevelIdx) -> bool
+			{
+				const int32 Node = LevelOrder[LevelStart + LevelIdx];
+				const int32 Parent = Parents[Node];
+
+				if (Parent == INDEX_NONE)
+				{
+					if (Dirty[Node])
+					{
+						WorldTransforms[Node] = LocalTransforms[Node];
+						return true;
+					}
+					return false;
+				}
+
+				// Dirty if changed itself or if the parent was recomputed this pass
+				if (Dirty[Node] || Dirty[Parent])
+				{
+					WorldTransforms[Node] = LocalTransforms[Node] * WorldTransforms[Parent];
+					Dirty[Node] = 1;  // Children in the next level see it
+					return true;
+				}
+				return false;
+			};
+
+			if (LevelSize < MinParallelLevelSize)
+			{
+				int32 LevelUpdated = 0;
+				for (int32 LevelIdx = 0; LevelIdx < LevelSize; LevelIdx++)
+				{
+					LevelUpdated += UpdateNode(LevelIdx) ? 1 : 0;
+				}
+				NumUpdated += LevelUpdated;
+			}
+			else
+			{
+				// One task per batch of nodes, counting locally to keep the shared counter cold
+				const int32 NumBatches = FMath::DivideAndRoundUp(LevelSize, MinParallelLevelSize / 2);
+				ParallelFor(NumBatches, [&UpdateNode, &NumUpdated, LevelSize, NumBatches](int32 BatchIdx)
+				{
+					const int32 Begin = static_cast<int32>(static_cast<int64>(LevelSize) * BatchIdx / NumBatches);
+					const int32 End = static_cast<int32>(static_cast<int64>(LevelSize) * (BatchIdx + 1) / NumBatches);
+
+					int32 BatchUpdated = 0;
+					for (int32 LevelIdx = Begin; LevelIdx < End; LevelIdx++)
+					{
+						BatchUpdated += UpdateNode(LevelIdx) ? 1 : 0;
+					}
+					NumUpdated += BatchUpdated;
+				});
+			}
+		}
+
+		FMemory::Memzero(Dirty.GetData(), Dirty.Num());
+		bAnyDirty = false;
+
+		return NumUpdated.load();
+	}
+
+private:
+	void Allocate(int32 NumNodes)
+	{
+		Names.SetNum(NumNodes);
+		Parents.SetNumUninitialized(NumNodes);
+		Depths.SetNumUninitialized(NumNodes);
+		SubtreeSizes.SetNumUninitialized(NumNodes);
+		LocalTransforms.SetNum(NumNodes);
+		WorldTransforms.SetNum(NumNodes);
+		Dirty.SetNumUninitialized(NumNodes);
+	}
+
+	// Subtree sizes, the per-level order, and an initial full update
+	void BuildDerivedData()
+	{
+		const int32 NumNodes = Num();
+
+		// Children come after their parent in depth-first order, so one reverse pass sums subtrees
+		for (int32 Node = 0; Node < NumNodes; Node++)
+		{
+			SubtreeSizes[Node] = 1;
+		}
+		for (int32 Node = NumNodes - 1; Node >= 0; Node--)
+		{
+			if (Parents[Node] != INDEX_NONE)
+			{
+				SubtreeSizes[Parents[Node]] += SubtreeSizes[Node];
+			}
+		}
+
+		// Counting sort by depth - stable, so each level stays in depth-first order
+		int32 MaxDepth = 0;
+		for (int32 Node = 0; Node < NumNodes; Node++)
+		{
+			MaxDepth = FMath::Max(MaxDepth, Depths[Node]);
+		}
+
+		LevelOffsets.Init(0, NumNodes > 0 ? MaxDepth + 2 : 1);
+		for (int32 Node = 0; Node < NumNodes; Node++)
+		{
+			LevelOffsets[Depths[Node] + 1]++;
+		}
+		for (int32 Level = 1; Level < LevelOffsets.Num(); Level++)
+		{
+			LevelOffsets[Level] += LevelOffsets[Level - 1];
+		}
+
+		LevelOrder.SetNumUninitialized(NumNodes);
+		TArray<int32> Cursor(LevelOffsets);
+		for (int32 Node = 0; Node < NumNodes; Node++)
+		{
+			LevelOrder[Cursor[Depths[Node]]++] = Node;
+		}
+
+		// Everything starts dirty so the first update computes all world transforms
+		FMemory::Memset(Dirty.GetData(), 1, Dirty.Num());
+		bAnyDirty = NumNodes > 0;
+		UpdateWorldTransforms();
+	}
+
+	TArray<FName> Names;
+	TArray<int32> Parents;
+	TArray<int32> Depths;
+	TArray<int32> SubtreeSizes;
+	TArray<FTransform> LocalTransforms;
+	TArray<FTransform> WorldTransforms;
+	TArray<uint8> Dirty;  // Bytes, not bits - workers write neighbouring entries concurrently
+
+	TArray<int32> LevelOrder;    // Node indices grouped by depth
+	TArray<int32> LevelOffsets;  // Level L is LevelOrder[LevelOffsets[L] .. LevelOffsets[L + 1])
+	bool bAnyDirty = false;
+};
+
+// Example usage
+class FFlatSceneHierarchyExamples
+{
+public:
+	// Example 1: Build a large scene, then move one branch
+	void DirtyBranchUpdate()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Flat Scene Hierarchy: Dirty Branch ==="));
+
+		// 1 root, 100 districts, 10 buildings each, 100 props per building = 101,101 nodes
+		TArray<FSceneNodeDesc> Descs;
+		Descs.Add(FSceneNodeDesc{TEXT("World")});
+		for (int32 District = 0; District < 100; District++)
+		{
+			const int32 DistrictIdx = Descs.Add(FSceneNodeDesc{TEXT("District"), 0, FTransform(FVector(District * 1000.0f, 0, 0))});
+			for (int32 Building = 0; Building < 10; Building++)
+			{
+				const int32 BuildingIdx = Descs.Add(FSceneNodeDesc{TEXT("Building"), DistrictIdx, FTransform(FVector(0, Building * 100.0f, 0))});
+				for (int32 Prop = 0; Prop < 100; Prop++)
+				{
+					Descs.Add(FSceneNodeDesc{TEXT("Prop"), BuildingIdx, FTransform(FVector(0, 0, Prop * 1.0f))});
+				}
+			}
+		}
+
+		TArray<int32> DescToNode;
+		const double BuildStart = FPlatformTime::Seconds();
+		FFlatSceneHierarchy Scene = FFlatSceneHierarchy::Build(Descs, &DescToNode);
+		UE_LOG(LogTemp, Log, TEXT("Built %d nodes in %d levels (%.2f ms, includes the first full update)"),
+			Scene.Num(), Scene.GetNumLevels(), (FPlatformTime::Seconds() - BuildStart) * 1000.0);
+
+		// Move one district - only its 1,011 nodes are recomputed
+		const int32 District = DescToNode[1];
+		Scene.SetLocalTransform(District, FTransform(FVector(0, 0, 500.0f)));
+
+		const double UpdateStart = FPlatformTime::Seconds();
+		const int32 NumUpdated = Scene.UpdateWorldTransforms();
+		UE_LOG(LogTemp, Log, TEXT("Recomputed %d of %d nodes in %.3f ms"),
+			NumUpdated, Scene.Num(), (FPlatformTime::Seconds() - UpdateStart) * 1000.0);
+	}
+
+	// Example 2: Convert an existing FSceneNode tree
+	void FromPointerTree()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Flat Scene Hierarchy: From FSceneNode ==="));
+
+		TSharedPtr<FSceneNode> Root = MakeShared<FSceneNode>(TEXT("Root"));
+		TSharedPtr<FSceneNode> Arm = MakeShared<FSceneNode>(TEXT("Arm"));
+		Root->Children.Add(Arm);
+		Arm->Children.Add(MakeShared<FSceneNode>(TEXT("Hand")));
+
+		FFlatSceneHierarchy Flat = FFlatSceneHierarchy::FromSceneNode(*Root);
+		Flat.PrintHierarchy();
+
+		// Hand -> Root by index, no Pin()
+		UE_LOG(LogTemp, Log, TEXT("Root of node 2: %s"), *Flat.GetName(Flat.GetRoot(2)).ToString());
+	}
+
+	// Example 3: WRONG - pointer-chasing traversal in a hot loop
+	void PointerChasingAntiPattern()
+	{
+		/* DON'T DO THIS (per frame, 100k nodes):
+		for (TSharedPtr<FSceneNode>& Node : AllNodes)
+		{
+			TSharedPtr<FSceneNode> Root = Node->GetRoot();   // Pin() per level: atomics + cache misses
+			Node->World = Node->Local * Node->Parent.Pin()->World;   // Parent may not be updated yet
+		}
+		*/
+
+		// DO THIS:
+		// Scene.SetLocalTransform(Node, NewLocal);   // Marks the branch
+		// Scene.UpdateWorldTransforms();             // Level by level, dirty branches only
+	}
+};
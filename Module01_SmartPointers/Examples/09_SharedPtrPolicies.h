@@ -0,0 +1,486 @@
+// Example 9: Shared Pointer Policies
+// Pick the reference count mode per type, check single-thread ownership, and count refcount traffic
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+/*
+ * TSharedPtr<T> defaults to ESPMode::ThreadSafe: every copy, reset and Pin() is an
+ * atomic increment or decrement on the reference controller. For data that only ever
+ * lives on the game thread (configs, player stats, UI models) that's pure overhead -
+ * and in Pin()-heavy loops it shows up in profiles.
+ *
+ * Writing ESPMode::NotThreadSafe at every declaration is noisy and easy to get wrong,
+ * so this file moves the choice to the type:
+ *
+ *   DECLARE_SHARED_PTR_POLICY(FGameplayConfig, ESPMode::NotThreadSafe);
+ *
+ *   TOwnedSharedPtr<FGameplayConfig>   = TSharedPtr<FGameplayConfig, ESPMode::NotThreadSafe>
+ *   TOwnedSharedRef / TOwnedWeakPtr    - same for refs and weak pointers
+ *   MakeOwnedShared<FGameplayConfig>() - MakeShared with the declared mode
+ *
+ * Types without a declaration stay ThreadSafe. The aliases are plain TSharedPtrs: no
+ * overhead, full interop.
+ *
+ * TCheckedSharedPtr / TCheckedWeakPtr wrap the same pointers for code you want to watch.
+ * With SHARED_PTR_POLICY_CHECKS on (non-shipping by default):
+ * - NotThreadSafe pointers remember the thread that created them, and every copy, reset,
+ *   dereference or Pin() from another thread fails a check - the race becomes a crash
+ *   with a callstack instead of a corrupted count
+ * - Strong reference increments, decrements and Pin() calls are counted per declared type.
+ *   FSharedRefCountStats rolls the counters over every frame, so LogLastFrame() shows how
+ *   much refcount traffic each type caused in the previous frame.
+ * With checks off the wrappers compile down to the TSharedPtr operations.
+ */
+
+#ifndef SHARED_PTR_POLICY_CHECKS
+#define SHARED_PTR_POLICY_CHECKS !UE_BUILD_SHIPPING
+#endif
+
+// Undeclared types: thread-safe, counted under one shared name
+template<typename T>
+struct TSharedPtrPolicy
+{
+	static constexpr ESPMode Mode = ESPMode::ThreadSafe;
+	static const TCHAR* GetName() { return TEXT("Undeclared"); }
+};
+
+// Global scope only - specializes TSharedPtrPolicy for Type
+#define DECLARE_SHARED_PTR_POLICY(Type, InMode) \
+	template<> \
+	struct TSharedPtrPolicy<Type> \
+	{ \
+		static constexpr ESPMode Mode = InMode; \
+		static const TCHAR* GetName() { return TEXT(#Type); } \
+	}
+
+template<typename T>
+using TOwnedSharedPtr = TSharedPtr<T, TSharedPtrPolicy<T>::Mode>;
+
+template<typename T>
+using TOwnedSharedRef = TSharedRef<T, TSharedPtrPolicy<T>::Mode>;
+
+template<typename T>
+using TOwnedWeakPtr = TWeakPtr<T, TSharedPtrPolicy<T>::Mode>;
+
+template<typename T, typename... ArgTypes>
+TOwnedSharedRef<T> MakeOwnedShared(ArgTypes&&... Args)
+{
+	return MakeShared<T, TSharedPtrPolicy<T>::Mode>(Forward<ArgTypes>(Args)...);
+}
+
+// Per-type refcount counters, rolled over once per frame on the game thread
+class FSharedRefCountStats
+{
+public:
+	struct FCounters
+	{
+		std::atomic<int64> Increments{0};
+		std::atomic<int64> Decrements{0};
+		std::atomic<int64> Pins{0};
+		std::atomic<int64> FailedPins{0};
+	};
+
+	struct FFrameCounts
+	{
+		FName Type;
+		int64 Increments = 0;
+		int64 Decrements = 0;
+		int64 Pins = 0;
+		int64 FailedPins = 0;
+	};
+
+	// Created on first use, never destroyed - pointers may be released during shutdown
+	static FSharedRefCountStats& Get()
+	{
+		static FSharedRefCountStats* Instance = new FSharedRefCountStats();
+		return *Instance;
+	}
+
+	// Called once per type; the counters live as long as the process
+	FCounters& FindOrAdd(FName Type)
+	{
+		FScopeLock Lock(&CountersLock);
+		TUniquePtr<FCounters>& Counters = CountersByType.FindOrAdd(Type);
+		if (!Counters)
+		{
+			Counters = MakeUnique<FCounters>();
+		}
+		return *Counters;
+	}
+
+	// Counts from the last completed frame, busiest type first
+	TArray<FFrameCounts> GetLastFrame() const
+	{
+		FScopeLock Lock(&CountersLock);
+		return LastFrame;
+	}
+
+	void LogLastFrame() const
+	{
+		for (const FFrameCounts& Counts : GetLastFrame())
+		{
+			UE_LOG(LogTemp, Log, TEXT("Refcounts %s: +%lld -%lld, %lld pins (%lld failed)"),
+				*Counts.Type.ToString(), Counts.Increments, Counts.Decrements, Counts.Pins, Counts.FailedPins);
+		}
+	}
+
+private:
+	FSharedRefCountStats()
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+		{
+			EndFrame();
+			return true;  // Keep ticking
+		}));
+	}
+
+	void EndFrame()
+	{
+		FScopeLock Lock(&CountersLock);
+		LastFrame.Reset();
+
+		for (const TPair<FName, TUniquePtr<FCounters>>& Pair : CountersByType)
+		{
+			FFrameCounts Counts;
+			Counts.Type = Pair.Key;
+			Counts.Increments = Pair.Value->Increments.exchange(0, std::memory_order_relaxed);
+			Counts.Decrements = Pair.Value->Decrements.exchange(0, std::memory_order_relaxed);
+			Counts.Pins = Pair.Value->Pins.exchange(0, std::memory_order_relaxed);
+			Counts.FailedPins = Pair.Value->FailedPins.exchange(0, std::memory_order_relaxed);
+
+			if (Counts.Increments + Counts.Decrements + Counts.Pins > 0)
+			{
+				LastFrame.Add(Counts);
+			}
+		}
+
+		LastFrame.Sort([](const FFrameCounts& A, const FFrameCounts& B)
+		{
+			return A.Increments + A.Decrements > B.Increments + B.Decrements;
+		});
+	}
+
+	mutable FCriticalSection CountersLock;
+	TMap<FName, TUniquePtr<FCounters>> CountersByType;
+	TArray<FFrameCounts> LastFrame;
+};
+
+namespace SharedPtrPolicyPrivate
+{
+	template<typename T>
+	FSharedRefCountStats::FCounters& GetCounters()
+	{
+		static FSharedRefCountStats::FCounters& Counters = FSharedRefCountStats::Get().FindOrAdd(TSharedPtrPolicy<T>::GetName());
+		return Counters;
+	}
+
+	// Owner thread, recorded when a checked pointer is created and copied along with it
+	struct FOwnerThread
+	{
+#if SHARED_PTR_POLICY_CHECKS
+		uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+#endif
+
+		template<ESPMode Mode>
+		void Check(const TCHAR* TypeName) const
+		{
+#if SHARED_PTR_POLICY_CHECKS
+			if constexpr (Mode == ESPMode::NotThreadSafe)
+			{
+				checkf(FPlatformTLS::GetCurrentThreadId() == ThreadId,
+					TEXT("%s is declared NotThreadSafe but its shared pointer was used off its owner thread"), TypeName);
+			}
+#endif
+		}
+	};
+}
+
+template<typename T>
+class TCheckedWeakPtr;
+
+// TOwnedSharedPtr<T> with an owner-thread check and refcount counters (see above)
+template<typename T>
+class TCheckedSharedPtr
+{
+public:
+	static constexpr ESPMode Mode = TSharedPtrPolicy<T>::Mode;
+	using FPointerType = TSharedPtr<T, Mode>;
+
+	TCheckedSharedPtr() = default;
+
+	TCheckedSharedPtr(TYPE_OF_NULLPTR)
+	{
+	}
+
+	// Adopts InPtr - counted as one new reference held by a checked pointer
+	TCheckedSharedPtr(FPointerType InPtr)
+		: Ptr(MoveTemp(InPtr))
+	{
+		CountIncrement();
+	}
+
+	TCheckedSharedPtr(const TSharedRef<T, Mode>& InRef)
+		: Ptr(InRef)
+	{
+		CountIncrement();
+	}
+
+	TCheckedSharedPtr(const TCheckedSharedPtr& Other)
+		: Ptr(Other.Ptr)
+		, Owner(Other.Owner)
+	{
+		Check();
+		CountIncrement();
+	}
+
+	// Moves don't touch the reference count. A null source has nothing to check.
+	TCheckedSharedPtr(TCheckedSharedPtr&& Other)
+		: Ptr(MoveTemp(Other.Ptr))
+		, Owner(Other.Owner)
+	{
+		CheckIfValid();
+	}
+
+	// The destination is only checked if it holds a reference - a null pointer may have been
+	// default-constructed on any thread. The source is checked against its own owner.
+	TCheckedSharedPtr& operator=(const TCheckedSharedPtr& Other)
+	{
+		if (this != &Other)
+		{
+			CheckIfValid();
+			Other.Check();
+			CountDecrement();
+			Ptr = Other.Ptr;
+			Owner = Other.Owner;
+			CountIncrement();
+		}
+		return *this;
+	}
+
+	TCheckedSharedPtr& operator=(TCheckedSharedPtr&& Other)
+	{
+		if (this != &Other)
+		{
+			CheckIfValid();
+			Other.Check();
+			CountDecrement();
+			Ptr = MoveTemp(Other.Ptr);
+			Owner = Other.Owner;
+		}
+		return *this;
+	}
+
+	~TCheckedSharedPtr()
+	{
+		if (Ptr.IsValid())
+		{
+			Check();
+			CountDecrement();
+		}
+	}
+
+	void Reset()
+	{
+		CheckIfValid();
+		CountDecrement();
+		Ptr.Reset();
+	}
+
+	bool IsValid() const { return Ptr.IsValid(); }
+	explicit operator bool() const { return Ptr.IsValid(); }
+
+	T* Get() const
+	{
+		Check();
+		return Ptr.Get();
+	}
+
+	T* operator->() const { return Get(); }
+	T& operator*() const { return *Get(); }
+
+	int32 GetSharedReferenceCount() const { return Ptr.GetSharedReferenceCount(); }
+
+	// A plain copy for APIs that take TSharedPtr - not counted or checked from here on
+	FPointerType ToSharedPtr() const
+	{
+		Check();
+		return Ptr;
+	}
+
+private:
+	friend class TCheckedWeakPtr<T>;
+
+	void Check() const
+	{
+		Owner.template Check<Mode>(TSharedPtrPolicy<T>::GetName());
+	}
+
+	void CheckIfValid() const
+	{
+		if (Ptr.IsValid())
+		{
+			Check();
+		}
+	}
+
+	void CountIncrement() const
+	{
+#if SHARED_PTR_POLICY_CHECKS
+		if (Ptr.IsValid())
+		{
+			SharedPtrPolicyPrivate::GetCounters<T>().Increments.fetch_add(1, std::memory_order_relaxed);
+		}
+#endif
+	}
+
+	void CountDecrement() const
+	{
+#if SHARED_PTR_POLICY_CHECKS
+		if (Ptr.IsValid())
+		{
+			SharedPtrPolicyPrivate::GetCounters<T>().Decrements.fetch_add(1, std::memory_order_relaxed);
+		}
+#endif
+	}
+
+	FPointerType Ptr;
+	SharedPtrPolicyPrivate::FOwnerThread Owner;
+};
+
+template<typename T>
+class TCheckedWeakPtr
+{
+public:
+	static constexpr ESPMode Mode = TSharedPtrPolicy<T>::Mode;
+
+	TCheckedWeakPtr() = default;
+
+	TCheckedWeakPtr(const TCheckedSharedPtr<T>& Shared)
+		: Ptr(Shared.Ptr)
+		, Owner(Shared.Owner)
+	{
+		Shared.Check();
+	}
+
+	// Counted: one Pin, and one increment if it succeeded
+	TCheckedSharedPtr<T> Pin() const
+	{
+		Owner.template Check<Mode>(TSharedPtrPolicy<T>::GetName());
+
+		TSharedPtr<T, Mode> Pinned = Ptr.Pin();
+#if SHARED_PTR_POLICY_CHECKS
+		FSharedRefCountStats::FCounters& Counters = SharedPtrPolicyPrivate::GetCounters<T>();
+		Counters.Pins.fetch_add(1, std::memory_order_relaxed);
+		if (!Pinned.IsValid())
+		{
+			Counters.FailedPins.fetch_add(1, std::memory_order_relaxed);
+		}
+#endif
+
+		TCheckedSharedPtr<T> Result(MoveTemp(Pinned));
+		Result.Owner = Owner;
+		return Result;
+	}
+
+	bool IsValid() const { return Ptr.IsValid(); }
+
+	void Reset()
+	{
+		Owner.template Check<Mode>(TSharedPtrPolicy<T>::GetName());
+		Ptr.Reset();
+	}
+
+private:
+	TWeakPtr<T, Mode> Ptr;
+	SharedPtrPolicyPrivate::FOwnerThread Owner;
+};
+
+template<typename T, typename... ArgTypes>
+TCheckedSharedPtr<T> MakeCheckedShared(ArgTypes&&... Args)
+{
+	return TCheckedSharedPtr<T>(MakeOwnedShared<T>(Forward<ArgTypes>(Args)...));
+}
+
+// Example usage
+struct FHudModel
+{
+	int32 Ammo = 30;
+	int32 Score = 0;
+};
+
+struct FSimulationSnapshot
+{
+	TArray<FVector> Positions;
+};
+
+// FHudModel is only ever touched on the game thread; FSimulationSnapshot is handed to tasks
+DECLARE_SHARED_PTR_POLICY(FHudModel, ESPMode::NotThreadSafe);
+DECLARE_SHARED_PTR_POLICY(FSimulationSnapshot, ESPMode::ThreadSafe);
+
+class FSharedPtrPolicyExamples
+{
+public:
+	// Example 1: Mode chosen by the type, not the declaration
+	void PolicyAliases()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Shared Pointer Policies: Aliases ==="));
+
+		TOwnedSharedRef<FHudModel> Hud = MakeOwnedShared<FHudModel>();              // Non-atomic counts
+		TOwnedSharedPtr<FSimulationSnapshot> Snapshot = MakeOwnedShared<FSimulationSnapshot>();  // Atomic counts
+
+		static_assert(TSharedPtrPolicy<FHudModel>::Mode == ESPMode::NotThreadSafe, "Declared game-thread only");
+
+		TOwnedWeakPtr<FHudModel> WeakHud = Hud;
+		UE_LOG(LogTemp, Log, TEXT("Ammo: %d"), WeakHud.Pin()->Ammo);
+	}
+
+	// Example 2: Measure the refcount traffic of a Pin()-heavy loop
+	void MeasurePinTraffic()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Shared Pointer Policies: Pin Traffic ==="));
+
+		TCheckedSharedPtr<FHudModel> Hud = MakeCheckedShared<FHudModel>();
+		TArray<TCheckedWeakPtr<FHudModel>> Widgets;
+		Widgets.Init(TCheckedWeakPtr<FHudModel>(Hud), 100);
+
+		int32 Total = 0;
+		for (const TCheckedWeakPtr<FHudModel>& Widget : Widgets)
+		{
+			// Every Pin() is an increment + decrement on the controller
+			if (TCheckedSharedPtr<FHudModel> Model = Widget.Pin())
+			{
+				Total += Model->Score;
+			}
+		}
+
+		// Counted this frame. Once Hud goes out of scope too, the next frame's LogLastFrame()
+		// shows FHudModel: +101 -101, 100 pins - 200 atomic ops if it were ThreadSafe
+		UE_LOG(LogTemp, Log, TEXT("Read %d widgets (total %d) - see FSharedRefCountStats::Get().LogLastFrame() next frame"),
+			Widgets.Num(), Total);
+
+		// The fix the counters point at: pin once, pass the reference down
+		// const FHudModel& Model = *Hud;   for (...) { Total += Model.Score; }
+	}
+
+	// Example 3: WRONG - a NotThreadSafe pointer copied into a task
+	void CrossThreadCopyAntiPattern()
+	{
+		/* DON'T DO THIS:
+		TCheckedSharedPtr<FHudModel> Hud = MakeCheckedShared<FHudModel>();
+		UE::Tasks::Launch(TEXT("Bad"), [Hud]()    // Copy on the game thread is fine...
+		{
+			Hud->Score++;                        // ...but this check fails: off the owner thread.
+		});                                      // With a raw NotThreadSafe TSharedPtr the task's
+		                                         // release would race the game thread's counts.
+		*/
+
+		// DO THIS:
+		// Copy the data the task needs, or declare the type ThreadSafe
+	}
+};
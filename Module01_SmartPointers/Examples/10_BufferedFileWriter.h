@@ -0,0 +1,267 @@
+// Example 10: Buffered File Writer
+// Double-buffered pages flushed to disk by a background task, owned through TUniquePtr
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/StringBuilder.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+/*
+ * A log or telemetry writer that calls the file system on every line stalls the calling
+ * thread on I/O - usually the game thread, usually at the worst moment.
+ *
+ * FBufferedFileWriter appends encoded (UTF-8) bytes into one of two pages:
+ * - The ACTIVE page is filled by the owning thread - a memcpy, no I/O
+ * - When it's full it becomes the FLUSHING page: a UE::Tasks task writes it to the file
+ *   while the owner keeps filling the other page
+ * - The owner only waits if it fills a whole page before the previous one hit the disk
+ *   (counted as a stall in GetStats())
+ *
+ * Barriers:
+ * - Flush() submits the active page, waits for the write, and flushes the OS file buffers
+ * - Close() is Flush() plus closing the file. The destructor calls Close(), so whoever
+ *   owns the TUniquePtr<FBufferedFileWriter> gets the same guarantee as an unbuffered
+ *   file: once the writer is destroyed, everything written is on disk.
+ *
+ * WriteLinef() formats into a stack TStringBuilder and encodes straight into the page -
+ * no temporary FString per line.
+ *
+ * The writer is neither copyable nor movable: the background task refers to it by
+ * address. Hold it by TUniquePtr and move the pointer instead.
+ *
+ * Threading: one thread writes; the background task only touches the page it was given.
+ */
+
+struct FBufferedFileWriterSettings
+{
+	int32 PageSize = 64 * 1024;  // Bytes per page - two are allocated
+	bool bAppend = false;
+};
+
+struct FBufferedFileWriterStats
+{
+	int64 BytesWritten = 0;  // Submitted to the file so far
+	int32 PagesWritten = 0;
+	int32 Stalls = 0;        // Times the writer waited on a flush in progress
+};
+
+class FBufferedFileWriter
+{
+public:
+	// Returns null if the file can't be opened
+	static TUniquePtr<FBufferedFileWriter> Open(const FString& FilePath, const FBufferedFileWriterSettings& Settings = FBufferedFileWriterSettings())
+	{
+		IFileHandle* Handle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath, Settings.bAppend);
+		if (!Handle)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Could not open %s for writing"), *FilePath);
+			return nullptr;
+		}
+
+		return TUniquePtr<FBufferedFileWriter>(new FBufferedFileWriter(TUniquePtr<IFileHandle>(Handle), Settings.PageSize));
+	}
+
+	~FBufferedFileWriter()
+	{
+		Close();
+	}
+
+	FBufferedFileWriter(const FBufferedFileWriter&) = delete;
+	FBufferedFileWriter& operator=(const FBufferedFileWriter&) = delete;
+
+	// Encodes Text as UTF-8 into the active page
+	void Write(FStringView Text)
+	{
+		if (!File || Text.IsEmpty())
+		{
+			return;
+		}
+
+		const int32 NumBytes = FPlatformString::ConvertedLength<UTF8CHAR>(Text.GetData(), Text.Len());
+		UTF8CHAR* Dest = Reserve(NumBytes);
+		FPlatformString::Convert(Dest, NumBytes, Text.GetData(), Text.Len());
+	}
+
+	void WriteLine(FStringView Line)
+	{
+		Write(Line);
+		Write(TEXT("\n"));
+	}
+
+	// printf-style line, formatted on the stack
+	template<typename FormatType, typename... ArgTypes>
+	void WriteLinef(const FormatType& Format, ArgTypes... Args)
+	{
+		TStringBuilder<512> Builder;
+		Builder.Appendf(Format, Args...);
+		Builder.AppendChar(TEXT('\n'));
+		Write(Builder.ToView());
+	}
+
+	// Barrier: everything written so far reaches the file before this returns
+	void Flush()
+	{
+		if (!File)
+		{
+			return;
+		}
+
+		SubmitActivePage();
+		PendingWrite.Wait();
+		File->Flush(true);  // Full flush - the handle's buffers alone don't reach the disk
+	}
+
+	// Flush, then close. Further writes are ignored.
+	void Close()
+	{
+		if (!File)
+		{
+			return;
+		}
+
+		Flush();
+		File.Reset();
+
+		if (bWriteFailed.load())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Buffered writer: one or more page writes failed"));
+		}
+	}
+
+	bool IsOpen() const { return File.IsValid(); }
+	bool HasWriteFailed() const { return bWriteFailed.load(); }
+	int32 GetPageSize() const { return PageSize; }
+
+	const FBufferedFileWriterStats& GetStats() const { return Stats; }
+
+private:
+	FBufferedFileWriter(TUniquePtr<IFileHandle> InFile, int32 InPageSize)
+		: File(MoveTemp(InFile))
+		, PageSize(FMath::Max(InPageSize, 256))
+	{
+		Pages[0].Reserve(PageSize);
+		Pages[1].Reserve(PageSize);
+	}
+
+	// Returns room for NumBytes at the end of the active page, submitting it first if it's too full
+	UTF8CHAR* Reserve(int32 NumBytes)
+	{
+		TArray<uint8>& Page = Pages[ActivePage];
+		if (Page.Num() + NumBytes > PageSize && Page.Num() > 0)
+		{
+			SubmitActivePage();
+		}
+
+		// A single write bigger than a page gets a page of its own (the array grows for it)
+		TArray<uint8>& Target = Pages[ActivePage];
+		const int32 Offset = Target.Num();
+		Target.AddUninitialized(NumBytes);
+		return reinterpret_cast<UTF8CHAR*>(Target.GetData() + Offset);
+	}
+
+	// Hands the active page to a background write and switches to the other page
+	void SubmitActivePage()
+	{
+		if (Pages[ActivePage].Num() == 0)
+		{
+			return;
+		}
+
+		// The other page may still be on its way to disk - it must land first (keeps writes in order)
+		if (!PendingWrite.IsCompleted())
+		{
+			Stats.Stalls++;
+		}
+		PendingWrite.Wait();
+
+		const int32 PageToWrite = ActivePage;
+		Stats.BytesWritten += Pages[PageToWrite].Num();
+		Stats.PagesWritten++;
+
+		PendingWrite = UE::Tasks::Launch(TEXT("BufferedFileWrite"), [this, PageToWrite]()
+		{
+			TArray<uint8>& Page = Pages[PageToWrite];
+			if (!File->Write(Page.GetData(), Page.Num()))
+			{
+				bWriteFailed.store(true);
+			}
+			Page.Reset();  // Keeps the allocation for the next fill
+		});
+
+		ActivePage = 1 - ActivePage;
+	}
+
+	TUniquePtr<IFileHandle> File;
+	const int32 PageSize;
+
+	TArray<uint8> Pages[2];
+	int32 ActivePage = 0;
+	UE::Tasks::FTask PendingWrite;
+
+	std::atomic<bool> bWriteFailed{false};
+	FBufferedFileWriterStats Stats;
+};
+
+// Example usage
+class FBufferedFileWriterExamples
+{
+public:
+	// Example 1: Telemetry log - the game thread never waits on I/O unless it outruns the disk
+	void TelemetryLog()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Buffered Writer: Telemetry ==="));
+
+		const FString Path = FPaths::ProjectSavedDir() / TEXT("Telemetry.csv");
+		TUniquePtr<FBufferedFileWriter> Writer = FBufferedFileWriter::Open(Path);
+		if (!Writer)
+		{
+			return;
+		}
+
+		Writer->WriteLine(TEXT("Frame,DeltaMs,Entities"));
+		for (int32 Frame = 0; Frame < 10000; Frame++)
+		{
+			Writer->WriteLinef(TEXT("%d,%.3f,%d"), Frame, 16.6f, 1200 + Frame % 50);
+		}
+
+		const FBufferedFileWriterStats& Stats = Writer->GetStats();
+		UE_LOG(LogTemp, Log, TEXT("Submitted %d pages (%lld bytes), %d stalls"), Stats.PagesWritten, Stats.BytesWritten, Stats.Stalls);
+
+		Writer.Reset();  // Destructor = Close(): the last partial page is on disk when this returns
+	}
+
+	// Example 2: Flush() as a checkpoint before something that might not return
+	void CheckpointBeforeRiskyWork()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Buffered Writer: Checkpoint ==="));
+
+		FBufferedFileWriterSettings Settings;
+		Settings.PageSize = 16 * 1024;
+		Settings.bAppend = true;
+
+		TUniquePtr<FBufferedFileWriter> Writer = FBufferedFileWriter::Open(FPaths::ProjectSavedDir() / TEXT("Session.log"), Settings);
+		if (!Writer)
+		{
+			return;
+		}
+
+		Writer->WriteLine(TEXT("Loading level..."));
+		Writer->Flush();  // If loading crashes, this line is already in the file
+	}
+
+	// Example 3: WRONG - formatting a temporary FString per line
+	void TemporaryStringAntiPattern()
+	{
+		/* DON'T DO THIS:
+		Writer->WriteLine(FString::Printf(TEXT("%d,%.3f"), Frame, DeltaMs));  // Heap allocation every line
+		*/
+
+		// DO THIS:
+		// Writer->WriteLinef(TEXT("%d,%.3f"), Frame, DeltaMs);  // Formatted on the stack, encoded into the page
+	}
+};
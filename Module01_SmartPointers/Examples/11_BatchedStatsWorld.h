@@ -0,0 +1,480 @@
+// Example 11: Batched Stats World
+// Thousands of stat blocks in one SoA table, updated by a single parallel SIMD pass per frame
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+#include "06_RealWorld_Combined.h"
+
+/*
+ * FStatsSystem (06_RealWorld_Combined.h) updates one FPlayerStats through a TSharedPtr.
+ * That's fine for the player. For 5000 NPCs each ticking their own system, regen becomes
+ * 5000 virtual Tick calls, 5000 pointer dereferences to stat blocks scattered across the
+ * heap, and 5000 observer checks - a cache miss or two per NPC for a handful of adds.
+ *
+ * FStatsWorld stores every stat block as one row of a structure-of-arrays table:
+ *   Health[i], MaxHealth[i], HealthRegen[i], Stamina[i], MaxStamina[i], StaminaRegen[i]
+ *
+ * - Update(DeltaTime) regenerates every row in one pass: blocks of rows run in a
+ *   ParallelFor, and each block processes 4 rows per VectorRegister4Float instruction.
+ * - Health is kept as a float; the fraction is regen progress toward the next whole
+ *   point, so small per-frame regen isn't lost to rounding. Readers see whole points.
+ * - The pass compares old and new values and records which fields changed per row
+ *   (EStatsField bits). Flush() notifies observers only for those rows - and skips whole
+ *   blocks in which nothing changed.
+ * - Rows are addressed by FStatsHandle (slot index + generation). A destroyed row's slot
+ *   is reused with a new generation, so stale handles fail IsValid() instead of aliasing
+ *   someone else's stats. Replace TSharedPtr<FPlayerStats> members with a handle and a
+ *   reference to the world: Stats->Health becomes World.GetStats(Handle).Health.
+ *
+ * Game thread only: Update() blocks until the pass is done, and every other call mutates
+ * the table directly.
+ */
+
+// Row in an FStatsWorld - compare generations, never dereference
+struct FStatsHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+
+	bool operator==(const FStatsHandle& Other) const
+	{
+		return Index == Other.Index && Generation == Other.Generation;
+	}
+	bool operator!=(const FStatsHandle& Other) const { return !(*this == Other); }
+};
+
+class FStatsWorld
+{
+public:
+	// Rows per ParallelFor task - a multiple of 4 so every block is whole registers
+	static constexpr int32 RowsPerBlock = 1024;
+
+	explicit FStatsWorld(TConfigStoreRef<FGameplayConfig> ConfigStore)
+		: Config(ConfigStore)
+	{
+	}
+
+	// Adds a row; health regen follows the config's rate until SetRegenRates overrides it
+	FStatsHandle Create(const FPlayerStats& Initial = FPlayerStats(), float StaminaRegenPerSecond = 0.0f)
+	{
+		if (FreeSlots.Num() == 0)
+		{
+			AddSlots();
+		}
+
+		const int32 Index = FreeSlots.Pop();
+		Alive[Index] = 1;
+		Health[Index] = static_cast<float>(Initial.Health);
+		MaxHealth[Index] = static_cast<float>(Initial.MaxHealth);
+		HealthRegen[Index] = Config->HealthRegenRate;
+		UsesConfigRegen[Index] = 1;
+		Stamina[Index] = Initial.Stamina;
+		MaxStamina[Index] = FMath::Max(Initial.Stamina, 100.0f);
+		StaminaRegen[Index] = StaminaRegenPerSecond;
+		NumAlive++;
+
+		return FStatsHandle{Index, Generations[Index]};
+	}
+
+	// Frees the row and its observers; the handle (and every copy of it) becomes invalid
+	void Destroy(FStatsHandle Handle)
+	{
+		if (!IsValid(Handle))
+		{
+			return;
+		}
+
+		const int32 Index = Handle.Index;
+		Generations[Index]++;
+		Alive[Index] = 0;
+		ChangedFields[Index] = 0;
+		ResetSlot(Index);  // Zero rates - the pass never reports a change for a dead row
+		Observers.Remove(Index);
+		FreeSlots.Push(Index);
+		NumAlive--;
+	}
+
+	bool IsValid(FStatsHandle Handle) const
+	{
+		return Handle.Index >= 0 && Handle.Index < Alive.Num() && Alive[Handle.Index] && Generations[Handle.Index] == Handle.Generation;
+	}
+
+	int32 Num() const { return NumAlive; }
+
+	// Snapshot in the FPlayerStats shape, for code written against the shared pointer version
+	FPlayerStats GetStats(FStatsHandle Handle) const
+	{
+		check(IsValid(Handle));
+
+		FPlayerStats Stats;
+		Stats.Health = FMath::FloorToInt(Health[Handle.Index]);
+		Stats.MaxHealth = FMath::RoundToInt(MaxHealth[Handle.Index]);
+		Stats.Stamina = Stamina[Handle.Index];
+		return Stats;
+	}
+
+	// Same rules as FStatsSystem::ApplyDamage - scaled by the config's damage multiplier
+	void ApplyDamage(FStatsHandle Handle, int32 Damage)
+	{
+		if (IsValid(Handle))
+		{
+			const int32 ActualDamage = Damage * Config->DamageMultiplier;
+			SetHealth(Handle.Index, FMath::Max(0.0f, Health[Handle.Index] - ActualDamage));
+		}
+	}
+
+	void ModifyHealth(FStatsHandle Handle, int32 Delta)
+	{
+		if (IsValid(Handle))
+		{
+			SetHealth(Handle.Index, FMath::Clamp(Health[Handle.Index] + Delta, 0.0f, MaxHealth[Handle.Index]));
+		}
+	}
+
+	void ModifyStamina(FStatsHandle Handle, float Delta)
+	{
+		if (IsValid(Handle) && Delta != 0.0f)
+		{
+			Stamina[Handle.Index] = FMath::Clamp(Stamina[Handle.Index] + Delta, 0.0f, MaxStamina[Handle.Index]);
+			MarkChanged(Handle.Index, EStatsField::Stamina);
+		}
+	}
+
+	void SetMaxHealth(FStatsHandle Handle, int32 NewMaxHealth)
+	{
+		if (IsValid(Handle))
+		{
+			MaxHealth[Handle.Index] = static_cast<float>(NewMaxHealth);
+			MarkChanged(Handle.Index, EStatsField::MaxHealth);
+			SetHealth(Handle.Index, FMath::Min(Health[Handle.Index], MaxHealth[Handle.Index]));
+		}
+	}
+
+	void SetRegenRates(FStatsHandle Handle, float HealthPerSecond, float StaminaPerSecond)
+	{
+		if (IsValid(Handle))
+		{
+			HealthRegen[Handle.Index] = HealthPerSecond;
+			StaminaRegen[Handle.Index] = StaminaPerSecond;
+			UsesConfigRegen[Handle.Index] = 0;  // No longer follows config changes
+		}
+	}
+
+	// Observer.OnStatsChanged runs from Flush() when any field in InterestMask changed for this row
+	void AddObserver(FStatsHandle Handle, TWeakPtr<IStatsObserver> Observer, EStatsField InterestMask = EStatsField::All)
+	{
+		if (IsValid(Handle))
+		{
+			Observers.FindOrAdd(Handle.Index).Add(FObserverEntry{MoveTemp(Observer), InterestMask});
+		}
+	}
+
+	/*
+	 * Regenerates health and stamina of every row, clamped to their maximums.
+	 * Rows whose whole health points or stamina changed are flagged for Flush().
+	 */
+	void Update(float DeltaTime)
+	{
+		if (Config.Refresh())
+		{
+			ApplyConfigRegenRate();
+		}
+
+		const int32 NumBlocks = FMath::DivideAndRoundUp(Alive.Num(), RowsPerBlock);
+		if (NumBlocks == 0 || DeltaTime <= 0.0f)
+		{
+			return;
+		}
+
+		ParallelFor(NumBlocks, [this, DeltaTime](int32 BlockIdx)
+		{
+			const int32 StartIdx = BlockIdx * RowsPerBlock;
+			const int32 EndIdx = FMath::Min(StartIdx + RowsPerBlock, Alive.Num());
+			if (UpdateRows(StartIdx, EndIdx, DeltaTime))
+			{
+				DirtyBlocks[BlockIdx] = 1;  // One writer per block - no atomics needed
+			}
+		}, NumBlocks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	// Notifies observers of every row changed since the last flush, one call per observer
+	// with the union of changed fields. Returns the number of changed rows.
+	int32 Flush()
+	{
+		int32 NumChanged = 0;
+
+		for (int32 BlockIdx = 0; BlockIdx < DirtyBlocks.Num(); BlockIdx++)
+		{
+			if (!DirtyBlocks[BlockIdx])
+			{
+				continue;  // Nothing changed in these RowsPerBlock rows
+			}
+			DirtyBlocks[BlockIdx] = 0;
+
+			const int32 StartIdx = BlockIdx * RowsPerBlock;
+			const int32 EndIdx = FMath::Min(StartIdx + RowsPerBlock, Alive.Num());
+			for (int32 Index = StartIdx; Index < EndIdx; Index++)
+			{
+				const EStatsField Fields = static_cast<EStatsField>(ChangedFields[Index]);
+				if (Fields == EStatsField::None)
+				{
+					continue;
+				}
+
+				ChangedFields[Index] = 0;
+				NumChanged++;
+				NotifyRow(Index, Fields);
+			}
+		}
+
+		return NumChanged;
+	}
+
+private:
+	using FStream = TArray<float, TAlignedHeapAllocator<16>>;
+
+	struct FObserverEntry
+	{
+		TWeakPtr<IStatsObserver> Observer;
+		EStatsField InterestMask;
+	};
+
+	// Grows every stream by one register's worth of rows, so the pass has no scalar tail
+	void AddSlots()
+	{
+		const int32 FirstNew = Alive.Num();
+		const int32 NewNum = FirstNew + 4;
+
+		for (FStream* Stream : { &Health, &MaxHealth, &HealthRegen, &Stamina, &MaxStamina, &StaminaRegen })
+		{
+			Stream->SetNumZeroed(NewNum);
+		}
+		Alive.SetNumZeroed(NewNum);
+		UsesConfigRegen.SetNumZeroed(NewNum);
+		Generations.SetNumZeroed(NewNum);
+		ChangedFields.SetNumZeroed(NewNum);
+		DirtyBlocks.SetNumZeroed(FMath::DivideAndRoundUp(NewNum, RowsPerBlock));
+
+		// Lowest index is handed out first
+		for (int32 Index = NewNum - 1; Index >= FirstNew; Index--)
+		{
+			FreeSlots.Push(Index);
+		}
+	}
+
+	void ResetSlot(int32 Index)
+	{
+		Health[Index] = MaxHealth[Index] = HealthRegen[Index] = 0.0f;
+		Stamina[Index] = MaxStamina[Index] = StaminaRegen[Index] = 0.0f;
+		UsesConfigRegen[Index] = 0;
+	}
+
+	// A new config was published - rows without their own rate pick up its regen rate
+	void ApplyConfigRegenRate()
+	{
+		const float Rate = Config->HealthRegenRate;
+		for (int32 Index = 0; Index < UsesConfigRegen.Num(); Index++)
+		{
+			if (UsesConfigRegen[Index])
+			{
+				HealthRegen[Index] = Rate;
+			}
+		}
+	}
+
+	void SetHealth(int32 Index, float NewHealth)
+	{
+		const bool bWholePointsChanged = FMath::FloorToInt(NewHealth) != FMath::FloorToInt(Health[Index]);
+		Health[Index] = NewHealth;
+
+		if (bWholePointsChanged)
+		{
+			MarkChanged(Index, EStatsField::Health);
+		}
+	}
+
+	void MarkChanged(int32 Index, EStatsField Fields)
+	{
+		ChangedFields[Index] |= static_cast<uint8>(Fields);
+		DirtyBlocks[Index / RowsPerBlock] = 1;
+	}
+
+	// Rows [StartIdx, EndIdx) - StartIdx and EndIdx are multiples of 4. Returns true if any row changed.
+	bool UpdateRows(int32 StartIdx, int32 EndIdx, float DeltaTime)
+	{
+		const VectorRegister4Float Dt = VectorSetFloat1(DeltaTime);
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		bool bAnyChanged = false;
+
+		for (int32 i = StartIdx; i < EndIdx; i += 4)
+		{
+			const VectorRegister4Float OldHealth = VectorLoadAligned(Health.GetData() + i);
+			const VectorRegister4Float OldStamina = VectorLoadAligned(Stamina.GetData() + i);
+
+			// New = Clamp(Old + Rate * Dt, 0, Max)
+			const VectorRegister4Float NewHealth = VectorMax(Zero, VectorMin(
+				VectorMultiplyAdd(VectorLoadAligned(HealthRegen.GetData() + i), Dt, OldHealth),
+				VectorLoadAligned(MaxHealth.GetData() + i)));
+			const VectorRegister4Float NewStamina = VectorMax(Zero, VectorMin(
+				VectorMultiplyAdd(VectorLoadAligned(StaminaRegen.GetData() + i), Dt, OldStamina),
+				VectorLoadAligned(MaxStamina.GetData() + i)));
+
+			VectorStoreAligned(NewHealth, Health.GetData() + i);
+			VectorStoreAligned(NewStamina, Stamina.GetData() + i);
+
+			// One bit per lane: did the visible value change?
+			const int32 HealthBits = VectorMaskBits(VectorCompareNE(VectorFloor(OldHealth), VectorFloor(NewHealth)));
+			const int32 StaminaBits = VectorMaskBits(VectorCompareNE(OldStamina, NewStamina));
+
+			if ((HealthBits | StaminaBits) == 0)
+			{
+				continue;  // Common case for full-health rows - no per-row work at all
+			}
+
+			for (int32 Lane = 0; Lane < 4; Lane++)
+			{
+				uint8 Fields = 0;
+				Fields |= (HealthBits & (1 << Lane)) ? static_cast<uint8>(EStatsField::Health) : 0;
+				Fields |= (StaminaBits & (1 << Lane)) ? static_cast<uint8>(EStatsField::Stamina) : 0;
+				ChangedFields[i + Lane] |= Fields;
+			}
+			bAnyChanged = true;
+		}
+
+		return bAnyChanged;
+	}
+
+	void NotifyRow(int32 Index, EStatsField Fields)
+	{
+		TArray<FObserverEntry>* Entries = Observers.Find(Index);
+		if (!Entries)
+		{
+			return;
+		}
+
+		const FPlayerStats Stats = GetStats(FStatsHandle{Index, Generations[Index]});
+
+		// Observer callbacks may destroy rows (and this entry list) - notify from a copy
+		TArray<TSharedPtr<IStatsObserver>, TInlineAllocator<4>> ToNotify;
+		Entries->RemoveAll([Fields, &ToNotify](const FObserverEntry& Entry)
+		{
+			TSharedPtr<IStatsObserver> Observer = Entry.Observer.Pin();
+			if (!Observer.IsValid())
+			{
+				return true;  // Dead observers are dropped the first time their row changes
+			}
+			if (EnumHasAnyFlags(Entry.InterestMask, Fields))
+			{
+				ToNotify.Add(MoveTemp(Observer));
+			}
+			return false;
+		});
+
+		for (const TSharedPtr<IStatsObserver>& Observer : ToNotify)
+		{
+			Observer->OnStatsChanged(Stats, Fields);
+		}
+	}
+
+	TConfigView<FGameplayConfig> Config;  // Refreshed by Update()
+
+	// The table - one entry per slot, live or free
+	FStream Health;        // Float: fraction = regen progress toward the next whole point
+	FStream MaxHealth;
+	FStream HealthRegen;   // Points per second
+	FStream Stamina;
+	FStream MaxStamina;
+	FStream StaminaRegen;
+	TArray<uint8> Alive;
+	TArray<uint8> UsesConfigRegen;  // HealthRegen tracks Config->HealthRegenRate
+	TArray<uint32> Generations;
+	TArray<uint8> ChangedFields;  // EStatsField bits since the last Flush
+	TArray<uint8> DirtyBlocks;    // Per RowsPerBlock rows: anything in ChangedFields set?
+
+	TArray<int32> FreeSlots;
+	int32 NumAlive = 0;
+
+	// Sparse - most rows (crowd NPCs) have no observers
+	TMap<int32, TArray<FObserverEntry>> Observers;
+};
+
+// Example usage
+class FBatchedStatsExamples
+{
+public:
+	// Example 1: A crowd of NPCs - one pass per frame instead of one Tick per NPC
+	void CrowdRegen()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Batched Stats: Crowd Regen ==="));
+
+		FStatsWorld World(MakeConfigStore<FGameplayConfig>());
+
+		TArray<FStatsHandle> Npcs;
+		for (int32 i = 0; i < 5000; i++)
+		{
+			Npcs.Add(World.Create(FPlayerStats(), 5.0f));
+		}
+
+		// A fight damages every tenth NPC
+		for (int32 i = 0; i < Npcs.Num(); i += 10)
+		{
+			World.ApplyDamage(Npcs[i], 25);
+		}
+		UE_LOG(LogTemp, Log, TEXT("After damage: %d rows changed"), World.Flush());
+
+		// 0.5 HP/s: it takes two seconds of frames before a whole point shows up
+		int32 NumNotified = 0;
+		for (int32 Frame = 0; Frame < 120; Frame++)
+		{
+			World.Update(1.0f / 60.0f);
+			NumNotified += World.Flush();
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("NPC 0 health after 2 s: %d/%d, %d row changes over 120 frames"),
+			World.GetStats(Npcs[0]).Health, World.GetStats(Npcs[0]).MaxHealth, NumNotified);
+	}
+
+	// Example 2: Observers only hear about their own row, and only when it changed
+	void ObservedRows()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Batched Stats: Observers ==="));
+
+		FStatsWorld World(MakeConfigStore<FGameplayConfig>());
+		const FStatsHandle Boss = World.Create();
+		const FStatsHandle Minion = World.Create();
+
+		TSharedPtr<FStatsUIWidget> BossBar = MakeShared<FStatsUIWidget>(TEXT("BossHealthBar"));
+		World.AddObserver(Boss, BossBar, EStatsField::Health | EStatsField::MaxHealth);
+
+		World.ApplyDamage(Minion, 50);   // Not observed - no callback
+		World.ModifyStamina(Boss, -10);  // Boss changed, but not a field the bar shows
+		World.ApplyDamage(Boss, 30);     // Callback
+		World.Flush();
+
+		// Stale handles fail validation instead of reading the slot's next occupant
+		World.Destroy(Minion);
+		const FStatsHandle Reused = World.Create();
+		UE_LOG(LogTemp, Log, TEXT("Minion valid: %d, reused slot: %d"), World.IsValid(Minion), Reused.Index == Minion.Index);
+	}
+
+	// Example 3: WRONG - one ticking system per NPC
+	void PerNpcTickAntiPattern()
+	{
+		/* DON'T DO THIS:
+		for (ANpc* Npc : Npcs)          // 5000 actors, each with:
+		{
+			Npc->StatsSystem->RegenerateHealth(DeltaTime);   // TSharedPtr deref, heap scattered
+			Npc->ObservableStats->Flush();                   // Observer check even when nothing changed
+		}
+		*/
+
+		// DO THIS:
+		// World.Update(DeltaTime);   // One SoA pass, 4 NPCs per instruction, blocks in parallel
+		// World.Flush();             // Only changed rows with observers do any work
+	}
+};
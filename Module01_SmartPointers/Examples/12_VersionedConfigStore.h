@@ -0,0 +1,237 @@
+// Example 12: Versioned Config Store
+// Writers publish immutable snapshots, readers take them lock-free and cache one per frame
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+#include "07_ConcurrentObservers.h"
+#include <atomic>
+
+/*
+ * A TSharedRef<FGameplayConfig> handed to every system is one mutable object. As long as
+ * everything runs on the game thread that's fine. Once a reader runs in a task, a write
+ * like Config->DamageMultiplier = 2.0f races with it - and a reader that looks at two
+ * fields can see one old and one new value.
+ *
+ * TVersionedConfigStore<T> makes every published config immutable:
+ * - Writers call Update(Mutate): the current snapshot is copied, modified, and published
+ *   as a new TSharedRef<const T> with the next version number. Writers serialize on a
+ *   lock; readers never wait.
+ * - GetSnapshot() is lock-free (TRcuPtr, see 07_ConcurrentObservers.h) and returns a
+ *   reference-counted snapshot. It never changes - capture it in a task and every field
+ *   comes from the same version.
+ * - TConfigView<T> caches one snapshot. Refresh() once per frame costs one acquire atomic
+ *   load when nothing was published; reads through the view are plain loads. Systems
+ *   that read config in hot loops hold a view instead of the store.
+ *
+ *   TConfigStoreRef<FGameplayConfig> Store = MakeConfigStore<FGameplayConfig>();
+ *   TConfigView<FGameplayConfig> Config(Store);
+ *
+ *   Store->Update([](FGameplayConfig& Next) { Next.DamageMultiplier = 2.0f; });  // Any thread
+ *   Config.Refresh();                       // Start of frame, owning thread
+ *   Damage * Config->DamageMultiplier;      // Hot path - no atomics
+ *
+ * A publish copies the whole T - fine for config (written a few times per session),
+ * wrong for data that changes every frame.
+ */
+template<typename T>
+class TVersionedConfigStore
+{
+public:
+	using FSnapshot = TSharedRef<const T, ESPMode::ThreadSafe>;
+
+	explicit TVersionedConfigStore(T Initial = T())
+		: Current(FVersionedSnapshot{FSnapshot(MakeShared<T, ESPMode::ThreadSafe>(MoveTemp(Initial))), 1})
+	{
+	}
+
+	// Any thread, lock-free
+	FSnapshot GetSnapshot() const
+	{
+		return Current.Read()->Snapshot;
+	}
+
+	// Snapshot and the version it was published as, read together
+	FSnapshot GetSnapshot(uint64& OutVersion) const
+	{
+		typename TRcuPtr<FVersionedSnapshot>::FReadScope Scope = Current.Read();
+		OutVersion = Scope->Version;
+		return Scope->Snapshot;
+	}
+
+	// Any thread. Changes whenever a snapshot is published.
+	uint64 GetVersion() const
+	{
+		return Version.load(std::memory_order_acquire);
+	}
+
+	// Copy the current config, modify it, publish it. Returns the new version.
+	template<typename FuncType>
+	uint64 Update(FuncType&& Mutate)
+	{
+		uint64 NewVersion = 0;
+		Current.Update([&Mutate, &NewVersion](FVersionedSnapshot& Next)
+		{
+			T Value = *Next.Snapshot;
+			Mutate(Value);
+			Next.Snapshot = MakeShared<T, ESPMode::ThreadSafe>(MoveTemp(Value));
+			NewVersion = ++Next.Version;
+		});
+
+		// Only now that the snapshot is published - a reader that sees NewVersion finds it in Current.
+		// Outside the writer lock two writers can get here out of order, so never move backwards.
+		uint64 Stored = Version.load(std::memory_order_relaxed);
+		while (Stored < NewVersion && !Version.compare_exchange_weak(Stored, NewVersion, std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
+		return NewVersion;
+	}
+
+	// Replace the whole config, e.g. after loading it from disk
+	uint64 Publish(T NewValue)
+	{
+		return Update([&NewValue](T& Next) { Next = MoveTemp(NewValue); });
+	}
+
+private:
+	struct FVersionedSnapshot
+	{
+		FSnapshot Snapshot;
+		uint64 Version;
+	};
+
+	TRcuPtr<FVersionedSnapshot> Current;
+	std::atomic<uint64> Version{1};
+};
+
+// Stores are shared by their writers and by every view
+template<typename T>
+using TConfigStoreRef = TSharedRef<TVersionedConfigStore<T>, ESPMode::ThreadSafe>;
+
+template<typename T>
+TConfigStoreRef<T> MakeConfigStore(T Initial = T())
+{
+	return MakeShared<TVersionedConfigStore<T>, ESPMode::ThreadSafe>(MoveTemp(Initial));
+}
+
+// One cached snapshot. Refresh() and the view itself belong to one thread (or one task);
+// give each reader its own view.
+template<typename T>
+class TConfigView
+{
+public:
+	explicit TConfigView(TSharedRef<const TVersionedConfigStore<T>, ESPMode::ThreadSafe> InStore)
+		: Store(InStore)
+		, Snapshot(InStore->GetSnapshot(Version))
+	{
+	}
+
+	// Picks up the latest snapshot. Returns true if it changed.
+	bool Refresh()
+	{
+		if (Store->GetVersion() == Version)
+		{
+			return false;  // Common case - one load, no reference counting
+		}
+
+		Snapshot = Store->GetSnapshot(Version);
+		return true;
+	}
+
+	const T& Get() const { return *Snapshot; }
+	const T& operator*() const { return *Snapshot; }
+	const T* operator->() const { return &Snapshot.Get(); }
+
+	// The cached snapshot itself - hand it to a task so it reads this frame's config
+	const typename TVersionedConfigStore<T>::FSnapshot& GetSnapshot() const { return Snapshot; }
+
+	uint64 GetVersion() const { return Version; }
+
+private:
+	TSharedRef<const TVersionedConfigStore<T>, ESPMode::ThreadSafe> Store;
+	uint64 Version = 0;
+	typename TVersionedConfigStore<T>::FSnapshot Snapshot;
+};
+
+// Example usage
+class FVersionedConfigExamples
+{
+public:
+	struct FRenderSettings
+	{
+		float Exposure = 1.0f;
+		float Gamma = 2.2f;
+		bool bBloom = true;
+	};
+
+	// Example 1: A worker reads a consistent snapshot while the game thread publishes
+	void SnapshotInTask()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Versioned Config: Snapshots ==="));
+
+		TConfigStoreRef<FRenderSettings> Store = MakeConfigStore<FRenderSettings>();
+
+		// The task captures the snapshot it was given - Exposure and Gamma always match
+		auto Task = UE::Tasks::Launch(TEXT("ToneMap"), [Settings = Store->GetSnapshot()]()
+		{
+			FPlatformProcess::Sleep(0.01f);
+			return Settings->Exposure / Settings->Gamma;
+		});
+
+		Store->Update([](FRenderSettings& Next)
+		{
+			Next.Exposure = 1.5f;
+			Next.Gamma = 2.4f;
+		});
+
+		UE_LOG(LogTemp, Log, TEXT("Task used version 1: %.3f, store is now version %llu"),
+			Task.GetResult(), Store->GetVersion());
+	}
+
+	// Example 2: Per-frame view - one check per frame, plain reads in the loop
+	void PerFrameView()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Versioned Config: Cached View ==="));
+
+		TConfigStoreRef<FRenderSettings> Store = MakeConfigStore<FRenderSettings>();
+		TConfigView<FRenderSettings> Settings(Store);
+
+		TArray<float> Pixels;
+		Pixels.Init(0.5f, 100000);
+
+		for (int32 Frame = 0; Frame < 3; Frame++)
+		{
+			if (Frame == 1)
+			{
+				Store->Update([](FRenderSettings& Next) { Next.Exposure = 2.0f; });  // Seen from the next Refresh()
+			}
+
+			const bool bChanged = Settings.Refresh();
+
+			float Sum = 0.0f;
+			for (float Pixel : Pixels)
+			{
+				Sum += Pixel * Settings->Exposure;  // No atomics, no refcount traffic per read
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("Frame %d: version %llu%s, average %.2f"),
+				Frame, Settings.GetVersion(), bChanged ? TEXT(" (refreshed)") : TEXT(""), Sum / Pixels.Num());
+		}
+	}
+
+	// Example 3: WRONG - writing a shared config that tasks are reading
+	void MutableSharedConfigAntiPattern()
+	{
+		/* DON'T DO THIS:
+		TSharedRef<FRenderSettings, ESPMode::ThreadSafe> Settings = MakeShared<FRenderSettings, ESPMode::ThreadSafe>();
+		UE::Tasks::Launch(TEXT("ToneMap"), [Settings]() { ToneMap(Settings->Exposure, Settings->Gamma); });
+		Settings->Exposure = 1.5f;   // Data race - the task may see the new Exposure with the old Gamma
+		Settings->Gamma = 2.4f;
+		*/
+
+		// DO THIS:
+		// Store->Update([](FRenderSettings& Next) { Next.Exposure = 1.5f; Next.Gamma = 2.4f; });
+		// Tasks capture Store->GetSnapshot() - immutable, one version
+	}
+};
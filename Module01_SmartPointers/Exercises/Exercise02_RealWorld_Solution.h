@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+#include "Tasks/Task.h"
 
 /*
  * SOLUTION: Complete Quest and Inventory System Implementation
@@ -33,7 +35,7 @@ struct FItem_Sol
 struct FQuestProgress_Sol
 {
 	int32 CurrentStep;
-	TArray<FString> CompletedObjectives;
+	TArray<FName> CompletedObjectives;  // FNames - compared as integers, appended without allocating strings
 
 	FQuestProgress_Sol()
 		: CurrentStep(0)
@@ -51,6 +53,9 @@ public:
 	// SOLUTION: Weak pointers - quest doesn't keep items alive
 	TArray<TWeakPtr<FItem_Sol>> RequiredItems;
 
+	// Objectives that must be completed (see FQuestManager_Sol::UpdateProgress)
+	TArray<FName> RequiredObjectives;
+
 	explicit FQuest_Sol(const FString& Name)
 		: QuestName(Name)
 	{
@@ -82,56 +87,309 @@ public:
 
 		return true;
 	}
+
+	// Silent version for sweeps: IsValid() checks the weak pointer without pinning it
+	bool HasRequiredItems() const
+	{
+		for (const TWeakPtr<FItem_Sol>& Item : RequiredItems)
+		{
+			if (!Item.IsValid())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool HasRequiredObjectives(const FQuestProgress_Sol& Progress) const
+	{
+		for (const FName& Objective : RequiredObjectives)
+		{
+			if (!Progress.CompletedObjectives.Contains(Objective))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+// Stable reference to an inventory entry - stays valid while other entries are added and removed.
+// The generation detects handles to entries that were removed (and whose slot was reused).
+struct FInventoryHandle_Sol
+{
+	int32 Slot = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Slot != INDEX_NONE; }
+};
+
+// Input for bulk adds (loot drops)
+struct FItemDesc_Sol
+{
+	FString ItemName;
+	int32 Value;
+	float Weight;
 };
 
 // Player inventory system
 class FInventorySystem_Sol
 {
 public:
-	// SOLUTION: TSharedPtr - items are shared with equipment and quests
-	TArray<TSharedPtr<FItem_Sol>> InventorySlots;
-
-	void AddItem(const FString& ItemName, int32 Value, float Weight)
+	/*
+	 * Indexed backend:
+	 * - InventorySlots, ItemValues and ItemWeights are dense, parallel arrays. Removal swaps
+	 *   the last entry into the hole (O(1), nothing shifts), so the order is not preserved.
+	 * - Handles point into a slot table that tracks where each entry currently lives.
+	 * - NameIndex maps FName -> handle slots, so lookups hash once instead of comparing
+	 *   every FString. It's a multimap - the same item name can be added more than once.
+	 * - Totals sum the contiguous value/weight arrays instead of chasing item pointers.
+	 *
+	 * Value and weight are captured when the item is added - treat them as immutable.
+	 */
+
+	FInventoryHandle_Sol AddItem(const FString& ItemName, int32 Value, float Weight)
 	{
-		// Create shared item
-		TSharedPtr<FItem_Sol> NewItem = MakeShared<FItem_Sol>(ItemName, Value, Weight);
-		InventorySlots.Add(NewItem);
+		FInventoryHandle_Sol Handle = AddItemInternal(ItemName, Value, Weight);
 
 		UE_LOG(LogTemp, Log, TEXT("Added to inventory: %s (Total items: %d)"),
 			*ItemName, InventorySlots.Num());
+
+		return Handle;
+	}
+
+	// One reservation and one log line for the whole batch
+	TArray<FInventoryHandle_Sol> AddItems(TConstArrayView<FItemDesc_Sol> Items)
+	{
+		Reserve(InventorySlots.Num() + Items.Num());
+
+		TArray<FInventoryHandle_Sol> Handles;
+		Handles.Reserve(Items.Num());
+		for (const FItemDesc_Sol& Desc : Items)
+		{
+			Handles.Add(AddItemInternal(Desc.ItemName, Desc.Value, Desc.Weight));
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Added %d items to inventory (Total items: %d)"), Items.Num(), InventorySlots.Num());
+		return Handles;
 	}
 
+	// Removes every entry with this name
 	void RemoveItem(const FString& ItemName)
 	{
-		int32 RemovedCount = InventorySlots.RemoveAll([&ItemName](const TSharedPtr<FItem_Sol>& Item)
+		TArray<int32, TInlineAllocator<4>> Slots;
+		NameIndex.MultiFind(FName(*ItemName), Slots);
+
+		for (int32 Slot : Slots)
 		{
-			return Item.IsValid() && Item->ItemName == ItemName;
-		});
+			RemoveSlot(Slot);
+		}
 
-		if (RemovedCount > 0)
+		if (Slots.Num() > 0)
 		{
 			UE_LOG(LogTemp, Log, TEXT("Removed from inventory: %s"), *ItemName);
 			// If quests were holding weak references, they'll detect item is gone
 		}
 	}
 
-	// SOLUTION: Return TSharedPtr for sharing
-	TSharedPtr<FItem_Sol> FindItem(const FString& ItemName) const
+	// Returns false if the handle was already removed
+	bool RemoveItem(FInventoryHandle_Sol Handle)
 	{
-		for (const TSharedPtr<FItem_Sol>& Item : InventorySlots)
+		if (!IsValid(Handle))
 		{
-			if (Item.IsValid() && Item->ItemName == ItemName)
+			return false;
+		}
+
+		RemoveSlot(Handle.Slot);
+		return true;
+	}
+
+	// Stale handles are skipped. Returns the number removed.
+	int32 RemoveItems(TConstArrayView<FInventoryHandle_Sol> Handles)
+	{
+		int32 NumRemoved = 0;
+		for (const FInventoryHandle_Sol& Handle : Handles)
+		{
+			if (IsValid(Handle))
 			{
-				return Item;
+				RemoveSlot(Handle.Slot);
+				NumRemoved++;
 			}
 		}
-		return nullptr;
+
+		UE_LOG(LogTemp, Log, TEXT("Removed %d items from inventory (Total items: %d)"), NumRemoved, InventorySlots.Num());
+		return NumRemoved;
+	}
+
+	// SOLUTION: Return TSharedPtr for sharing
+	TSharedPtr<FItem_Sol> FindItem(const FString& ItemName) const
+	{
+		return GetItem(FindHandle(ItemName));
+	}
+
+	FInventoryHandle_Sol FindHandle(const FString& ItemName) const
+	{
+		if (const int32* Slot = NameIndex.Find(FName(*ItemName)))
+		{
+			return FInventoryHandle_Sol{*Slot, HandleSlots[*Slot].Generation};
+		}
+		return FInventoryHandle_Sol();
+	}
+
+	TSharedPtr<FItem_Sol> GetItem(FInventoryHandle_Sol Handle) const
+	{
+		return IsValid(Handle) ? InventorySlots[HandleSlots[Handle.Slot].DenseIndex] : nullptr;
+	}
+
+	bool IsValid(FInventoryHandle_Sol Handle) const
+	{
+		return HandleSlots.IsValidIndex(Handle.Slot)
+			&& HandleSlots[Handle.Slot].DenseIndex != INDEX_NONE
+			&& HandleSlots[Handle.Slot].Generation == Handle.Generation;
 	}
 
 	int32 GetItemCount() const
 	{
 		return InventorySlots.Num();
 	}
+
+	// Dense view of the items - order changes when items are removed
+	TConstArrayView<TSharedPtr<FItem_Sol>> GetItems() const
+	{
+		return InventorySlots;
+	}
+
+	// 4 weights per iteration over the contiguous weight array
+	float GetTotalWeight() const
+	{
+		const int32 NumItems = ItemWeights.Num();
+		const float* Weights = ItemWeights.GetData();
+
+		VectorRegister4Float Sum = VectorZeroFloat();
+		int32 i = 0;
+		for (; i + 4 <= NumItems; i += 4)
+		{
+			Sum = VectorAdd(Sum, VectorLoadAligned(Weights + i));
+		}
+
+		alignas(16) float Lanes[4];
+		VectorStoreAligned(Sum, Lanes);
+		float Total = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+
+		for (; i < NumItems; i++)
+		{
+			Total += Weights[i];
+		}
+		return Total;
+	}
+
+	// Plain loop over contiguous int32s - compilers vectorize this on their own
+	int64 GetTotalValue() const
+	{
+		int64 Total = 0;
+		for (int32 Value : ItemValues)
+		{
+			Total += Value;
+		}
+		return Total;
+	}
+
+	// Called with the item's name whenever an entry is added or removed (see FQuestManager_Sol::OnItemChanged)
+	TFunction<void(FName ItemId)> OnItemChanged;
+
+	void Reserve(int32 NumItems)
+	{
+		InventorySlots.Reserve(NumItems);
+		ItemValues.Reserve(NumItems);
+		ItemWeights.Reserve(NumItems);
+		DenseToSlot.Reserve(NumItems);
+	}
+
+private:
+	struct FHandleSlot
+	{
+		int32 DenseIndex = INDEX_NONE;  // INDEX_NONE while the slot is free
+		uint32 Generation = 0;
+		FName Name;
+	};
+
+	FInventoryHandle_Sol AddItemInternal(const FString& ItemName, int32 Value, float Weight)
+	{
+		// Reuse a free slot if there is one
+		int32 Slot;
+		if (FreeSlots.Num() > 0)
+		{
+			Slot = FreeSlots.Pop();
+		}
+		else
+		{
+			Slot = HandleSlots.AddDefaulted();
+		}
+
+		FHandleSlot& HandleSlot = HandleSlots[Slot];
+		HandleSlot.DenseIndex = InventorySlots.Num();
+		HandleSlot.Name = FName(*ItemName);
+
+		// SOLUTION: TSharedPtr - items are shared with equipment and quests
+		InventorySlots.Add(MakeShared<FItem_Sol>(ItemName, Value, Weight));
+		ItemValues.Add(Value);
+		ItemWeights.Add(Weight);
+		DenseToSlot.Add(Slot);
+
+		NameIndex.Add(HandleSlot.Name, Slot);
+
+		if (OnItemChanged)
+		{
+			OnItemChanged(HandleSlot.Name);
+		}
+
+		return FInventoryHandle_Sol{Slot, HandleSlot.Generation};
+	}
+
+	void RemoveSlot(int32 Slot)
+	{
+		FHandleSlot& HandleSlot = HandleSlots[Slot];
+		const int32 DenseIndex = HandleSlot.DenseIndex;
+		const int32 LastIndex = InventorySlots.Num() - 1;
+
+		// The last entry moves into the hole - point its handle slot at the new position
+		if (DenseIndex != LastIndex)
+		{
+			HandleSlots[DenseToSlot[LastIndex]].DenseIndex = DenseIndex;
+		}
+
+		InventorySlots.RemoveAtSwap(DenseIndex);
+		ItemValues.RemoveAtSwap(DenseIndex);
+		ItemWeights.RemoveAtSwap(DenseIndex);
+		DenseToSlot.RemoveAtSwap(DenseIndex);
+
+		NameIndex.RemoveSingle(HandleSlot.Name, Slot);
+
+		// Bumping the generation invalidates every outstanding handle to this slot
+		const FName RemovedName = HandleSlot.Name;
+		HandleSlot.DenseIndex = INDEX_NONE;
+		HandleSlot.Generation++;
+		HandleSlot.Name = NAME_None;
+		FreeSlots.Add(Slot);
+
+		// After the inventory's reference is gone - weak pointers to the item may now be dead
+		if (OnItemChanged)
+		{
+			OnItemChanged(RemovedName);
+		}
+	}
+
+	// Dense, parallel arrays - index i in each describes the same entry
+	TArray<TSharedPtr<FItem_Sol>> InventorySlots;
+	TArray<int32, TAlignedHeapAllocator<16>> ItemValues;
+	TArray<float, TAlignedHeapAllocator<16>> ItemWeights;
+	TArray<int32> DenseToSlot;
+
+	// Handle slot table and its free list
+	TArray<FHandleSlot> HandleSlots;
+	TArray<int32> FreeSlots;
+
+	TMultiMap<FName, int32> NameIndex;
 };
 
 // Equipment system that shares items with inventory
@@ -171,58 +429,173 @@ public:
 class FQuestManager_Sol
 {
 public:
-	// SOLUTION: TUniquePtr - each quest progression is uniquely owned
-	TMap<FString, TUniquePtr<FQuestProgress_Sol>> QuestProgression;
-
-	// Active quests
-	TArray<TSharedPtr<FQuest_Sol>> ActiveQuests;
+	/*
+	 * Incremental engine:
+	 * - Quests live in an array; QuestIndexByName maps FName -> index (no string compares)
+	 * - DependentQuests maps an item or objective ID to the quests that require it, so an
+	 *   inventory change or objective update re-checks only those quests
+	 * - Each quest's completion is cached; state changes are logged, unchanged quests stay quiet
+	 * - CheckAllQuests() is the full sweep, evaluated in parallel with UE::Tasks
+	 *
+	 * Dependencies must be added through the manager (AddRequiredItem / AddRequiredObjective)
+	 * so the index sees them.
+	 */
+
+	// Quests per task in a full sweep
+	static constexpr int32 QuestsPerSweepTask = 256;
 
 	TSharedPtr<FQuest_Sol> StartQuest(const FString& QuestName)
 	{
-		// Create unique quest progression
-		QuestProgression.Add(QuestName, MakeUnique<FQuestProgress_Sol>());
+		const FName QuestId(*QuestName);
+		const int32 QuestIndex = ActiveQuests.Num();
 
 		// Create shared quest (can be referenced by UI, etc.)
 		TSharedPtr<FQuest_Sol> NewQuest = MakeShared<FQuest_Sol>(QuestName);
 		ActiveQuests.Add(NewQuest);
 
+		// SOLUTION: TUniquePtr - each quest progression is uniquely owned
+		QuestProgression.Add(MakeUnique<FQuestProgress_Sol>());
+		QuestIndexByName.Add(QuestId, QuestIndex);
+		CompletionState.Add(0);
+
+		// No requirements yet - complete until some are added
+		RecheckQuest(QuestIndex);
+
 		UE_LOG(LogTemp, Log, TEXT("Started quest: %s"), *QuestName);
 		return NewQuest;
 	}
 
-	void UpdateProgress(const FString& QuestName, const FString& Objective)
+	void AddRequiredItem(const TSharedPtr<FQuest_Sol>& Quest, const FString& ItemName, TWeakPtr<FItem_Sol> Item)
 	{
-		if (TUniquePtr<FQuestProgress_Sol>* Progress = QuestProgression.Find(QuestName))
-		{
-			(*Progress)->CompletedObjectives.Add(Objective);
-			(*Progress)->CurrentStep++;
+		const int32 QuestIndex = QuestIndexByName.FindChecked(FName(*Quest->QuestName));
+		Quest->AddRequiredItem(ItemName, Item);
+
+		DependentQuests.FindOrAdd(FName(*ItemName)).AddUnique(QuestIndex);
+		RecheckQuest(QuestIndex);
+	}
+
+	void AddRequiredObjective(const TSharedPtr<FQuest_Sol>& Quest, FName Objective)
+	{
+		const int32 QuestIndex = QuestIndexByName.FindChecked(FName(*Quest->QuestName));
+		Quest->RequiredObjectives.AddUnique(Objective);
+
+		DependentQuests.FindOrAdd(Objective).AddUnique(QuestIndex);
+		RecheckQuest(QuestIndex);
+	}
 
-			UE_LOG(LogTemp, Log, TEXT("Quest '%s' updated: %s (Step %d)"),
-				*QuestName, *Objective, (*Progress)->CurrentStep);
+	void UpdateProgress(FName QuestId, FName Objective)
+	{
+		const int32* QuestIndex = QuestIndexByName.Find(QuestId);
+		if (!QuestIndex)
+		{
+			return;
 		}
+
+		FQuestProgress_Sol& Progress = *QuestProgression[*QuestIndex];
+		Progress.CompletedObjectives.Add(Objective);
+		Progress.CurrentStep++;
+
+		UE_LOG(LogTemp, Log, TEXT("Quest '%s' updated: %s (Step %d)"),
+			*QuestId.ToString(), *Objective.ToString(), Progress.CurrentStep);
+
+		RecheckDependents(Objective);
 	}
 
-	FQuestProgress_Sol* GetQuestProgress(const FString& QuestName)
+	FQuestProgress_Sol* GetQuestProgress(FName QuestId)
 	{
-		if (TUniquePtr<FQuestProgress_Sol>* Progress = QuestProgression.Find(QuestName))
+		if (const int32* QuestIndex = QuestIndexByName.Find(QuestId))
 		{
-			return Progress->Get();  // Return raw pointer for temporary access
+			return QuestProgression[*QuestIndex].Get();  // Return raw pointer for temporary access
 		}
 		return nullptr;
 	}
 
+	// Wire to FInventorySystem_Sol::OnItemChanged - re-checks only quests that need ItemId
+	void OnItemChanged(FName ItemId)
+	{
+		RecheckDependents(ItemId);
+	}
+
+	bool IsQuestComplete(FName QuestId) const
+	{
+		const int32* QuestIndex = QuestIndexByName.Find(QuestId);
+		return QuestIndex && CompletionState[*QuestIndex] != 0;
+	}
+
+	// Full sweep: every quest evaluated in parallel, state changes logged afterwards on this thread
 	void CheckAllQuests()
 	{
-		for (TSharedPtr<FQuest_Sol>& Quest : ActiveQuests)
+		const int32 NumQuests = ActiveQuests.Num();
+		TArray<uint8> NewState;
+		NewState.SetNumUninitialized(NumQuests);
+
+		// Evaluation only reads quests and progress, and each task writes its own range of NewState
+		TArray<UE::Tasks::FTask> Tasks;
+		for (int32 Begin = 0; Begin < NumQuests; Begin += QuestsPerSweepTask)
+		{
+			const int32 End = FMath::Min(Begin + QuestsPerSweepTask, NumQuests);
+			Tasks.Add(UE::Tasks::Launch(TEXT("EvaluateQuests"), [this, &NewState, Begin, End]()
+			{
+				for (int32 QuestIndex = Begin; QuestIndex < End; QuestIndex++)
+				{
+					NewState[QuestIndex] = EvaluateQuest(QuestIndex) ? 1 : 0;
+				}
+			}));
+		}
+		UE::Tasks::Wait(Tasks);
+
+		int32 NumComplete = 0;
+		for (int32 QuestIndex = 0; QuestIndex < NumQuests; QuestIndex++)
+		{
+			ApplyState(QuestIndex, NewState[QuestIndex] != 0);
+			NumComplete += NewState[QuestIndex];
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Quest sweep: %d of %d complete"), NumComplete, NumQuests);
+	}
+
+private:
+	bool EvaluateQuest(int32 QuestIndex) const
+	{
+		const TSharedPtr<FQuest_Sol>& Quest = ActiveQuests[QuestIndex];
+		return Quest.IsValid()
+			&& Quest->HasRequiredItems()
+			&& Quest->HasRequiredObjectives(*QuestProgression[QuestIndex]);
+	}
+
+	void RecheckDependents(FName Id)
+	{
+		if (const TArray<int32>* Quests = DependentQuests.Find(Id))
 		{
-			if (Quest.IsValid())
+			for (int32 QuestIndex : *Quests)
 			{
-				bool bComplete = Quest->CheckCompletion();
-				UE_LOG(LogTemp, Log, TEXT("Quest '%s' complete: %s"),
-					*Quest->QuestName, bComplete ? TEXT("Yes") : TEXT("No"));
+				RecheckQuest(QuestIndex);
 			}
 		}
 	}
+
+	void RecheckQuest(int32 QuestIndex)
+	{
+		ApplyState(QuestIndex, EvaluateQuest(QuestIndex));
+	}
+
+	void ApplyState(int32 QuestIndex, bool bComplete)
+	{
+		if (CompletionState[QuestIndex] != static_cast<uint8>(bComplete))
+		{
+			CompletionState[QuestIndex] = bComplete ? 1 : 0;
+			UE_LOG(LogTemp, Log, TEXT("Quest '%s' complete: %s"),
+				*ActiveQuests[QuestIndex]->QuestName, bComplete ? TEXT("Yes") : TEXT("No"));
+		}
+	}
+
+	// Parallel arrays indexed by quest
+	TArray<TSharedPtr<FQuest_Sol>> ActiveQuests;
+	TArray<TUniquePtr<FQuestProgress_Sol>> QuestProgression;
+	TArray<uint8> CompletionState;
+
+	TMap<FName, int32> QuestIndexByName;
+	TMap<FName, TArray<int32>> DependentQuests;  // Item or objective ID -> quest indices
 };
 
 // Player stats shared across systems
@@ -266,6 +639,12 @@ public:
 		EquipmentSystem = MakeUnique<FEquipmentSystem_Sol>();
 		QuestManager = MakeUnique<FQuestManager_Sol>();
 
+		// Inventory changes re-check only the quests that depend on the changed item
+		InventorySystem->OnItemChanged = [Quests = QuestManager.Get()](FName ItemId)
+		{
+			Quests->OnItemChanged(ItemId);
+		};
+
 		UE_LOG(LogTemp, Log, TEXT("All systems initialized"));
 	}
 
@@ -284,6 +663,8 @@ public:
 		InventorySystem->AddItem(TEXT("Iron Sword"), 100, 5.0f);
 		InventorySystem->AddItem(TEXT("Health Potion"), 25, 0.5f);
 		InventorySystem->AddItem(TEXT("Dragon Scale"), 500, 1.0f);
+		UE_LOG(LogTemp, Log, TEXT("Total weight: %.1f, total value: %lld"),
+			InventorySystem->GetTotalWeight(), InventorySystem->GetTotalValue());
 
 		// 2. Equip an item (share reference)
 		UE_LOG(LogTemp, Log, TEXT("\n--- Step 2: Equipping weapon ---"));
@@ -302,24 +683,26 @@ public:
 		TSharedPtr<FItem_Sol> DragonScale = InventorySystem->FindItem(TEXT("Dragon Scale"));
 		if (DragonScale.IsValid())
 		{
-			DragonQuest->AddRequiredItem(TEXT("Dragon Scale"), DragonScale);  // Weak reference
-			UE_LOG(LogTemp, Log, TEXT("Dragon Scale ref count: %d (Only inventory has strong ref)"),
+			QuestManager->AddRequiredItem(DragonQuest, TEXT("Dragon Scale"), DragonScale);  // Weak reference, indexed
+			UE_LOG(LogTemp, Log, TEXT("Dragon Scale ref count: %d (Inventory + this local)"),
 				DragonScale.GetSharedReferenceCount());
 		}
+		DragonScale.Reset();  // Drop the local strong ref - otherwise it would keep the scale alive below
 
 		// Check quest - should pass
 		UE_LOG(LogTemp, Log, TEXT("\n--- Step 4: Checking quest (should pass) ---"));
 		QuestManager->CheckAllQuests();
 
-		// 4. Sell/remove the dragon scale
+		// 5. Sell/remove the dragon scale
+		// OnItemChanged re-checks only "Slay the Dragon" - the incomplete state is logged here
 		UE_LOG(LogTemp, Log, TEXT("\n--- Step 5: Selling dragon scale ---"));
 		InventorySystem->RemoveItem(TEXT("Dragon Scale"));
 
-		// Check quest - should fail now
+		// Full sweep - agrees with the incremental result, nothing new to log
 		UE_LOG(LogTemp, Log, TEXT("\n--- Step 6: Checking quest (should fail) ---"));
 		QuestManager->CheckAllQuests();
 
-		// 5. Verify sword is still equipped and referenced by both systems
+		// 7. Verify sword is still equipped and referenced by both systems
 		UE_LOG(LogTemp, Log, TEXT("\n--- Step 7: Verifying sword still works ---"));
 		if (EquipmentSystem->HasWeaponEquipped() && Sword.IsValid())
 		{
@@ -327,12 +710,26 @@ public:
 				*Sword->ItemName, Sword.GetSharedReferenceCount());
 		}
 
-		// 6. Unequip and remove sword
+		// 8. Unequip and remove sword
 		UE_LOG(LogTemp, Log, TEXT("\n--- Step 8: Unequipping and removing sword ---"));
 		EquipmentSystem->UnequipWeapon();
 		InventorySystem->RemoveItem(TEXT("Iron Sword"));
 		// Sword should be destroyed now (no more references)
 
+		// 9. Loot drop - bulk add, then pick some up and discard the rest by handle
+		UE_LOG(LogTemp, Log, TEXT("\n--- Step 9: Loot drop ---"));
+		TArray<FItemDesc_Sol> Loot;
+		for (int32 i = 0; i < 50; i++)
+		{
+			Loot.Add(FItemDesc_Sol{FString::Printf(TEXT("Coin Pouch %d"), i), 10, 0.2f});
+		}
+
+		TArray<FInventoryHandle_Sol> LootHandles = InventorySystem->AddItems(Loot);
+		UE_LOG(LogTemp, Log, TEXT("Total weight: %.1f, total value: %lld"),
+			InventorySystem->GetTotalWeight(), InventorySystem->GetTotalValue());
+
+		InventorySystem->RemoveItems(TConstArrayView<FInventoryHandle_Sol>(LootHandles).Slice(0, 40));
+
 		UE_LOG(LogTemp, Log, TEXT("\n=== Test Complete ===\n"));
 	}
 };
@@ -353,6 +750,8 @@ inline void RunGameManagerTest()
  * 3. TUniquePtr<FQuestProgress> - Each quest's progression is uniquely owned by manager
  * 4. TSharedPtr<FPlayerStats> - Stats shared across multiple systems
  * 5. TUniquePtr<Systems> - Game manager uniquely owns all subsystems
+ * 6. Handles + dense arrays - O(1) lookup and removal, totals over contiguous memory
+ * 7. Dependency index - item/objective changes re-check only the quests that need them
  *
  * This demonstrates real-world patterns you'll use in game development!
  */
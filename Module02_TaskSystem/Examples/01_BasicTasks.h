@@ -155,6 +155,8 @@ public:
 		);
 
 		// High priority task likely runs first, but not guaranteed
+		// To measure what each priority actually waits - and reserve workers for latency-sensitive
+		// tasks - see FPriorityScheduler in 18_PriorityScheduling.h
 		UE::Tasks::Wait(TArray{LowTask, NormalTask, HighTask});
 	}
 
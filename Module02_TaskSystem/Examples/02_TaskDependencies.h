@@ -5,6 +5,9 @@
 
 #include "CoreMinimal.h"
 #include "Tasks/Task.h"
+#include "13_TaskTracing.h"
+#include "14_SharedTaskResults.h"
+#include "15_FusedRanges.h"
 
 class FTaskDependencyExamples
 {
@@ -27,19 +30,19 @@ public:
 		});
 
 		// Task 2: Process data (depends on Task 1)
+		// Only consumer of LoadTask - move the array out instead of copying it (see 14_SharedTaskResults.h)
 		auto ProcessTask = UE::Tasks::Launch(
 			TEXT("ProcessData"),
-			[LoadTask]() -> TArray<int32>
+			[LoadTask]() mutable -> TArray<int32>
 			{
 				UE_LOG(LogTemp, Log, TEXT("Processing data..."));
 
-				TArray<int32> LoadedData = LoadTask.GetResult();
-				TArray<int32> ProcessedData;
+				TArray<int32> ProcessedData = TakeResult(LoadTask);
 
-				// Double each value
-				for (int32 Value : LoadedData)
+				// Double each value - in place, no second array
+				for (int32& Value : ProcessedData)
 				{
-					ProcessedData.Add(Value * 2);
+					Value *= 2;
 				}
 
 				UE_LOG(LogTemp, Log, TEXT("Data processed: %d items"), ProcessedData.Num());
@@ -55,7 +58,8 @@ public:
 			{
 				UE_LOG(LogTemp, Log, TEXT("Saving data..."));
 
-				TArray<int32> ProcessedData = ProcessTask.GetResult();
+				// Read through a reference - GetResult() returns the task's own array
+				const TArray<int32>& ProcessedData = ProcessTask.GetResult();
 
 				UE_LOG(LogTemp, Log, TEXT("Saved %d values"), ProcessedData.Num());
 				for (int32 Value : ProcessedData)
@@ -76,8 +80,8 @@ public:
 	{
 		UE_LOG(LogTemp, Log, TEXT("=== Fan-Out Pattern ==="));
 
-		// Source task
-		auto SourceTask = UE::Tasks::Launch(TEXT("Source"), []() -> TArray<int32>
+		// Source task - result shared read-only by all three workers, one buffer, no copies
+		auto SourceTask = LaunchShared(TEXT("Source"), []() -> TArray<int32>
 		{
 			UE_LOG(LogTemp, Log, TEXT("Generating source data..."));
 			return TArray<int32>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
@@ -88,7 +92,7 @@ public:
 			TEXT("Worker1"),
 			[SourceTask]() -> int32
 			{
-				TArray<int32> Data = SourceTask.GetResult();
+				TConstArrayView<int32> Data = ViewResult(SourceTask);
 				int32 Sum = 0;
 				for (int32 Value : Data)
 				{
@@ -104,7 +108,7 @@ public:
 			TEXT("Worker2"),
 			[SourceTask]() -> int32
 			{
-				TArray<int32> Data = SourceTask.GetResult();
+				TConstArrayView<int32> Data = ViewResult(SourceTask);
 				int32 Product = 1;
 				for (int32 Value : Data)
 				{
@@ -120,7 +124,7 @@ public:
 			TEXT("Worker3"),
 			[SourceTask]() -> int32
 			{
-				TArray<int32> Data = SourceTask.GetResult();
+				TConstArrayView<int32> Data = ViewResult(SourceTask);
 				int32 Max = Data.Num() > 0 ? Data[0] : 0;
 				for (int32 Value : Data)
 				{
@@ -138,34 +142,37 @@ public:
 	}
 
 	// Example 3: Fan-in pattern (multiple tasks → one task)
+	// Traced (13_TaskTracing.h) - the report shows Source2 gating Combine
 	void FanInPattern()
 	{
 		UE_LOG(LogTemp, Log, TEXT("=== Fan-In Pattern ==="));
 
+		FTaskTraceSession Trace(TEXT("FanIn"));
+
 		// Multiple source tasks
-		auto Source1 = UE::Tasks::Launch(TEXT("Source1"), []() -> int32
+		auto Source1 = Trace.Launch(TEXT("Source1"), []() -> int32
 		{
 			UE_LOG(LogTemp, Log, TEXT("Source1 generating..."));
 			FPlatformProcess::Sleep(0.1f);
 			return 10;
 		});
 
-		auto Source2 = UE::Tasks::Launch(TEXT("Source2"), []() -> int32
+		auto Source2 = Trace.Launch(TEXT("Source2"), []() -> int32
 		{
 			UE_LOG(LogTemp, Log, TEXT("Source2 generating..."));
 			FPlatformProcess::Sleep(0.15f);
 			return 20;
 		});
 
-		auto Source3 = UE::Tasks::Launch(TEXT("Source3"), []() -> int32
+		auto Source3 = Trace.Launch(TEXT("Source3"), []() -> int32
 		{
 			UE_LOG(LogTemp, Log, TEXT("Source3 generating..."));
 			FPlatformProcess::Sleep(0.05f);
 			return 30;
 		});
 
-		// Combine task waits for all sources
-		auto CombineTask = UE::Tasks::Launch(
+		// Combine task waits for all sources - prerequisites are trailing arguments
+		auto CombineTask = Trace.Launch(
 			TEXT("Combine"),
 			[Source1, Source2, Source3]() -> int32
 			{
@@ -180,27 +187,31 @@ public:
 
 				return Total;
 			},
-			UE::Tasks::Prerequisites(Source1, Source2, Source3)
+			Source1, Source2, Source3
 		);
 
 		int32 FinalResult = CombineTask.GetResult();
 		UE_LOG(LogTemp, Log, TEXT("Final result: %d"), FinalResult);
+		Trace.Analyze().Log(*Trace.GetName());
 	}
 
 	// Example 4: Complex dependency graph (diamond pattern)
+	// Traced (13_TaskTracing.h) - the report and Diamond.json show which branch gated Bottom
 	void DiamondDependency()
 	{
 		UE_LOG(LogTemp, Log, TEXT("=== Diamond Dependency Pattern ==="));
 
+		FTaskTraceSession Trace(TEXT("Diamond"));
+
 		// Top: Initial task
-		auto TopTask = UE::Tasks::Launch(TEXT("Top"), []() -> int32
+		auto TopTask = Trace.Launch(TEXT("Top"), []() -> int32
 		{
 			UE_LOG(LogTemp, Log, TEXT("Top task"));
 			return 100;
 		});
 
 		// Left: Depends on Top
-		auto LeftTask = UE::Tasks::Launch(
+		auto LeftTask = Trace.Launch(
 			TEXT("Left"),
 			[TopTask]() -> int32
 			{
@@ -208,11 +219,11 @@ public:
 				UE_LOG(LogTemp, Log, TEXT("Left task, input: %d"), Value);
 				return Value + 10;
 			},
-			UE::Tasks::Prerequisites(TopTask)
+			TopTask
 		);
 
 		// Right: Depends on Top
-		auto RightTask = UE::Tasks::Launch(
+		auto RightTask = Trace.Launch(
 			TEXT("Right"),
 			[TopTask]() -> int32
 			{
@@ -220,11 +231,11 @@ public:
 				UE_LOG(LogTemp, Log, TEXT("Right task, input: %d"), Value);
 				return Value + 20;
 			},
-			UE::Tasks::Prerequisites(TopTask)
+			TopTask
 		);
 
 		// Bottom: Depends on both Left and Right
-		auto BottomTask = UE::Tasks::Launch(
+		auto BottomTask = Trace.Launch(
 			TEXT("Bottom"),
 			[LeftTask, RightTask]() -> int32
 			{
@@ -238,20 +249,26 @@ public:
 
 				return Result;
 			},
-			UE::Tasks::Prerequisites(LeftTask, RightTask)
+			LeftTask, RightTask
 		);
 
 		int32 Final = BottomTask.GetResult();
 		UE_LOG(LogTemp, Log, TEXT("Diamond complete! Result: %d"), Final);
+
+		Trace.Analyze().Log(*Trace.GetName());
+		Trace.ExportChromeTrace(FPaths::ProfilingDir() / TEXT("Diamond.json"));
 	}
 
 	// Example 5: Pipeline with filtering
+	// Traced (13_TaskTracing.h) - a chain, so every stage is on the critical path
 	void PipelineWithFiltering()
 	{
 		UE_LOG(LogTemp, Log, TEXT("=== Pipeline with Filtering ==="));
 
+		FTaskTraceSession Trace(TEXT("PipelineWithFiltering"));
+
 		// Stage 1: Generate data
-		auto GenerateTask = UE::Tasks::Launch(TEXT("Generate"), []() -> TArray<int32>
+		auto GenerateTask = Trace.Launch(TEXT("Generate"), []() -> TArray<int32>
 		{
 			UE_LOG(LogTemp, Log, TEXT("Generating numbers..."));
 			TArray<int32> Numbers;
@@ -263,52 +280,44 @@ public:
 		});
 
 		// Stage 2: Filter even numbers
-		auto FilterTask = UE::Tasks::Launch(
+		auto FilterTask = Trace.Launch(
 			TEXT("Filter"),
-			[GenerateTask]() -> TArray<int32>
+			[GenerateTask]() mutable -> TArray<int32>
 			{
-				TArray<int32> Input = GenerateTask.GetResult();
-				TArray<int32> Output;
-
-				for (int32 Num : Input)
-				{
-					if (Num % 2 == 0)
-					{
-						Output.Add(Num);
-					}
-				}
+				// Each stage is the only reader of the previous one - take the array and edit it in place
+				TArray<int32> Output = TakeResult(GenerateTask.Task);
+				Output.RemoveAll([](int32 Num) { return Num % 2 != 0; });
 
 				UE_LOG(LogTemp, Log, TEXT("Filtered to %d even numbers"), Output.Num());
 				return Output;
 			},
-			UE::Tasks::Prerequisites(GenerateTask)
+			GenerateTask
 		);
 
 		// Stage 3: Square the numbers
-		auto SquareTask = UE::Tasks::Launch(
+		auto SquareTask = Trace.Launch(
 			TEXT("Square"),
-			[FilterTask]() -> TArray<int32>
+			[FilterTask]() mutable -> TArray<int32>
 			{
-				TArray<int32> Input = FilterTask.GetResult();
-				TArray<int32> Output;
+				TArray<int32> Output = TakeResult(FilterTask.Task);
 
-				for (int32 Num : Input)
+				for (int32& Num : Output)
 				{
-					Output.Add(Num * Num);
+					Num = Num * Num;
 				}
 
 				UE_LOG(LogTemp, Log, TEXT("Squared %d numbers"), Output.Num());
 				return Output;
 			},
-			UE::Tasks::Prerequisites(FilterTask)
+			FilterTask
 		);
 
 		// Stage 4: Sum the results
-		auto SumTask = UE::Tasks::Launch(
+		auto SumTask = Trace.Launch(
 			TEXT("Sum"),
 			[SquareTask]() -> int32
 			{
-				TArray<int32> Input = SquareTask.GetResult();
+				const TArray<int32>& Input = SquareTask.GetResult();
 				int32 Sum = 0;
 
 				for (int32 Num : Input)
@@ -319,10 +328,25 @@ public:
 				UE_LOG(LogTemp, Log, TEXT("Sum of squared evens: %d"), Sum);
 				return Sum;
 			},
-			UE::Tasks::Prerequisites(SquareTask)
+			SquareTask
 		);
 
 		int32 Result = SumTask.GetResult();
 		UE_LOG(LogTemp, Log, TEXT("Pipeline result: %d"), Result);
+		Trace.Analyze().Log(*Trace.GetName());
+	}
+
+	// Example 6: Same pipeline fused (see 15_FusedRanges.h)
+	// The stages read the same, but run as one loop per chunk across workers - no arrays between them
+	void PipelineWithFiltering_Fused()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Pipeline with Filtering (Fused) ==="));
+
+		const int32 Result = MakeFusedIota(1, 20)                       // Generate
+			.Filter([](int32 Num) { return Num % 2 == 0; })            // Filter even numbers
+			.Map([](int32 Num) { return Num * Num; })                  // Square
+			.Sum();                                                    // Sum
+
+		UE_LOG(LogTemp, Log, TEXT("Pipeline result: %d"), Result);
 	}
 };
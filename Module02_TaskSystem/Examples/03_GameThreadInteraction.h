@@ -6,12 +6,18 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Tasks/Task.h"
+#include "09_StreamingFileLoader.h"
+#include "10_GameThreadHandoff.h"
+#include "11_SoAPositions.h"
+#include "12_WorkerRandom.h"
+#include "16_BackgroundJobSubsystem.h"
+#include "17_TaskCancellation.h"
 #include "03_GameThreadInteraction.generated.h"
 
 // Example data structure (not a UObject - safe for background threads)
 struct FComputationResult
 {
-	TArray<FVector> Positions;
+	FPositionStreams Positions;  // SoA - see 11_SoAPositions.h, Positions.AsAoS() for FVector access
 	TArray<FRotator> Rotations;
 	float AverageDistance;
 };
@@ -31,32 +37,30 @@ public:
 		FVector StartLocation = GetActorLocation();
 		int32 NumPoints = 100;
 
+		// Seed + run index identify this batch - replaying with the same seed regenerates it exactly
+		const uint64 RandomKey = (static_cast<uint64>(GenerationSeed) << 32) | GenerationCount++;
+
 		// Launch background task
-		UE::Tasks::Launch(TEXT("ComputePositions"), [StartLocation, NumPoints]()
+		UE::Tasks::Launch(TEXT("ComputePositions"), [StartLocation, NumPoints, RandomKey]()
 		{
 			// BACKGROUND THREAD - No UObject access!
 			UE_LOG(LogTemp, Log, TEXT("Computing %d positions on background thread"), NumPoints);
 
-			TArray<FVector> ComputedPositions;
-			for (int32 i = 0; i < NumPoints; i++)
-			{
-				FVector Offset = FVector(
-					FMath::RandRange(-100.0f, 100.0f),
-					FMath::RandRange(-100.0f, 100.0f),
-					FMath::RandRange(-100.0f, 100.0f)
-				);
-
-				ComputedPositions.Add(StartLocation + Offset);
-			}
+			// Presized SoA streams, filled in place (see 11_SoAPositions.h).
+			// A task-local PCG stream fills each stream in one loop - no global RNG (see 12_WorkerRandom.h)
+			FPositionStreams ComputedPositions(NumPoints);
+			FPcgRandomStream Random = FWorkerRandom::ForTask(RandomKey);
+			Random.FillPositions(ComputedPositions, StartLocation, FVector(100.0f));
 
-			// Return to game thread to use results
-			AsyncTask(ENamedThreads::GameThread, [ComputedPositions]()
+			// Return to game thread to use results - moved, not copied, and run in the next
+			// per-frame flush together with every other queued completion (see 10_GameThreadHandoff.h)
+			FGameThreadHandoffQueue::Get().Enqueue([Positions = MoveTemp(ComputedPositions)]()
 			{
 				// GAME THREAD - Safe for UObjects
-				UE_LOG(LogTemp, Log, TEXT("Back on game thread with %d positions"), ComputedPositions.Num());
+				UE_LOG(LogTemp, Log, TEXT("Back on game thread with %d positions"), Positions.Num());
 
 				// Could spawn actors, modify components, etc.
-				// SpawnActorsAtPositions(ComputedPositions);
+				// SpawnActorsAtPositions(Positions.AsAoS());
 			});
 		});
 	}
@@ -69,11 +73,22 @@ public:
 		// Create weak pointer to self
 		TWeakObjectPtr<ATaskExampleActor> WeakThis(this);
 
-		UE::Tasks::Launch(TEXT("SafeOperation"), [WeakThis]()
+		// Cancelled as soon as this actor ends play (see 17_TaskCancellation.h)
+		const FCancellationToken Cancellation = Lifetime.MakeChild();
+
+		LaunchCancellable(TEXT("SafeOperation"), Cancellation, [WeakThis](const FCancellationToken& Token)
 		{
-			// Background work
+			// Background work - in chunks, so a destroyed actor frees this worker early
 			UE_LOG(LogTemp, Log, TEXT("Performing background calculation..."));
-			FPlatformProcess::Sleep(0.5f);
+			for (int32 Chunk = 0; Chunk < 10; Chunk++)
+			{
+				if (Token.IsCancelled())
+				{
+					UE_LOG(LogTemp, Log, TEXT("Actor gone, abandoning calculation after %d chunks"), Chunk);
+					return;
+				}
+				FPlatformProcess::Sleep(0.05f);
+			}
 
 			TArray<int32> Results = {1, 2, 3, 4, 5};
 
@@ -103,51 +118,61 @@ public:
 		TWeakObjectPtr<ATaskExampleActor> WeakThis(this);
 		FVector CurrentLocation = GetActorLocation();
 
+		// One token for the whole chain: every stage checks it before starting, so once the
+		// actor ends play no further stage is launched
+		const FCancellationToken Cancellation = Lifetime.MakeChild();
+
 		// Stage 1: Background processing
-		UE::Tasks::Launch(TEXT("Stage1"), [WeakThis, CurrentLocation]()
+		LaunchCancellable(TEXT("Stage1"), Cancellation, [WeakThis, CurrentLocation](const FCancellationToken& Token)
 		{
 			UE_LOG(LogTemp, Log, TEXT("Stage 1: Background processing"));
 
-			// Heavy computation
-			TArray<FVector> ProcessedData;
-			for (int32 i = 0; i < 50; i++)
+			// Heavy computation - written in place into presized streams
+			const int32 NumPoints = 50;
+			FPositionStreams ProcessedData(NumPoints);
+			for (int32 i = 0; i < NumPoints; i++)
 			{
-				ProcessedData.Add(CurrentLocation + FVector(i * 10.0f, 0, 0));
+				ProcessedData.X[i] = static_cast<float>(CurrentLocation.X) + i * 10.0f;
+				ProcessedData.Y[i] = static_cast<float>(CurrentLocation.Y);
+				ProcessedData.Z[i] = static_cast<float>(CurrentLocation.Z);
 			}
 
 			FPlatformProcess::Sleep(0.1f);
 
 			// Stage 2: Return to game thread for UObject access
-			AsyncTask(ENamedThreads::GameThread, [WeakThis, ProcessedData]()
+			// WeakThis is checked once on arrival; the callback only runs if the actor is alive.
+			// Dispatched right away rather than queued - Stage 3 waits on it.
+			if (Token.IsCancelled())
 			{
-				if (!WeakThis.IsValid())
-				{
-					return;
-				}
+				return;  // Don't queue a game thread hop for an actor that's gone
+			}
 
+			SendToGameThread(WeakThis, MoveTemp(ProcessedData), [Cancellation = Token](ATaskExampleActor& Actor, FPositionStreams&& Data)
+			{
 				UE_LOG(LogTemp, Log, TEXT("Stage 2: On game thread, reading UObject data"));
 
 				// Could access UObject properties here
-				// float SomeProperty = WeakThis->GetSomeValue();
+				// float SomeProperty = Actor.GetSomeValue();
 
 				// Stage 3: Back to background thread for more processing
-				UE::Tasks::Launch(TEXT("Stage3"), [ProcessedData]()
+				LaunchCancellable(TEXT("Stage3"), Cancellation, [ProcessedData = MoveTemp(Data)](const FCancellationToken& Stage3Token)
 				{
 					UE_LOG(LogTemp, Log, TEXT("Stage 3: More background processing"));
 
-					TArray<float> Distances;
-					for (const FVector& Pos : ProcessedData)
-					{
-						Distances.Add(Pos.Size());
-					}
+					// Vectorized: 4 lengths per instruction from the X/Y/Z streams
+					TArray<float> Distances = ProcessedData.ComputeLengths();
 
 					FPlatformProcess::Sleep(0.1f);
+					if (Stage3Token.IsCancelled())
+					{
+						return;
+					}
 
-					// Stage 4: Final game thread callback
-					AsyncTask(ENamedThreads::GameThread, [Distances]()
+					// Stage 4: Final game thread callback - nothing waits on it, so it joins the per-frame batch
+					FGameThreadHandoffQueue::Get().Enqueue([FinalDistances = MoveTemp(Distances)]()
 					{
 						UE_LOG(LogTemp, Log, TEXT("Stage 4: Final results on game thread"));
-						UE_LOG(LogTemp, Log, TEXT("Processed %d distance values"), Distances.Num());
+						UE_LOG(LogTemp, Log, TEXT("Processed %d distance values"), FinalDistances.Num());
 					});
 				});
 			});
@@ -215,7 +240,43 @@ public:
 		);
 	}
 
-	// Example 5: Legacy AsyncTask pattern
+	// Example 5: Same work through the world's job subsystem (see 16_BackgroundJobSubsystem.h)
+	// Shares MaxJobsInFlight with every other actor, and the completion runs within the
+	// frame's completion budget - hundreds of actors doing this at once don't hitch
+	void ParallelProcessingBudgeted()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Parallel Processing (Budgeted) ==="));
+
+		UBackgroundJobSubsystem* Jobs = GetWorld()->GetSubsystem<UBackgroundJobSubsystem>();
+		if (!Jobs)
+		{
+			return;
+		}
+
+		const int32 NumTasks = 4;
+		Jobs->SubmitBatch(this, EBackgroundJobPriority::Normal, NumTasks,
+			[](int32 TaskIdx)
+			{
+				TArray<int32> LocalResults;
+				for (int32 i = 0; i < 100; i++)
+				{
+					LocalResults.Add(TaskIdx * 1000 + i);
+				}
+				return LocalResults;
+			},
+			[](ATaskExampleActor& Actor, TArray<TArray<int32>>&& PerTaskResults)
+			{
+				// One game thread callback for all four workers, only if the actor still exists
+				int32 NumResults = 0;
+				for (const TArray<int32>& Results : PerTaskResults)
+				{
+					NumResults += Results.Num();
+				}
+				UE_LOG(LogTemp, Log, TEXT("Applying %d results to actor"), NumResults);
+			});
+	}
+
+	// Example 6: Legacy AsyncTask pattern
 	void LegacyAsyncPattern()
 	{
 		UE_LOG(LogTemp, Log, TEXT("=== Legacy AsyncTask Pattern ==="));
@@ -237,19 +298,16 @@ public:
 
 			FPlatformProcess::Sleep(0.1f);
 
-			// Return to game thread
-			AsyncTask(ENamedThreads::GameThread, [WeakThis, Results]()
+			// Return to game thread - the queue takes callbacks from legacy AsyncTask workers too
+			FGameThreadHandoffQueue::Get().Enqueue(WeakThis, MoveTemp(Results), [](ATaskExampleActor& Actor, TArray<FVector>&& Arrived)
 			{
-				if (WeakThis.IsValid())
-				{
-					UE_LOG(LogTemp, Log, TEXT("Back on game thread"));
-					// Safe to access UObject members
-				}
+				UE_LOG(LogTemp, Log, TEXT("Back on game thread with %d results"), Arrived.Num());
+				// Safe to access UObject members
 			});
 		});
 	}
 
-	// Example 6: Dangerous pattern - DON'T DO THIS!
+	// Example 7: Dangerous pattern - DON'T DO THIS!
 	void DangerousPattern_Example()
 	{
 		UE_LOG(LogTemp, Warning, TEXT("=== DANGEROUS PATTERN - FOR DEMONSTRATION ONLY ==="));
@@ -279,6 +337,22 @@ public:
 			});
 		});
 	}
+
+	// Seed for PerformBackgroundComputation - the same seed reproduces the same positions
+	UPROPERTY(EditAnywhere, Category = "Tasks")
+	int32 GenerationSeed = 1337;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override
+	{
+		Lifetime.Cancel();  // ForOwner(this) would only notice after GC
+		Super::EndPlay(EndPlayReason);
+	}
+
+private:
+	uint32 GenerationCount = 0;
+
+	// Parent of every task chain this actor starts - cancelling it cancels all of them
+	FCancellationToken Lifetime = FCancellationToken::Create();
 };
 
 // Component example with async loading
@@ -295,34 +369,59 @@ public:
 
 		TWeakObjectPtr<UAsyncLoaderComponent> WeakThis(this);
 
-		// Background: Load from disk
-		UE::Tasks::Launch(TEXT("LoadFile"), [WeakThis, FilePath]()
+		// A new load supersedes the previous one, and the component going away cancels both
+		const FCancellationToken Cancellation = LoadCancellation.Reset(this);
+
+		// Background: Load from disk and parse (see 09_StreamingFileLoader.h)
+		LaunchCancellable(TEXT("LoadFile"), Cancellation, [WeakThis, FilePath](const FCancellationToken& Token)
 		{
 			UE_LOG(LogTemp, Log, TEXT("Loading file: %s"), *FilePath);
 
-			// Simulate file loading
-			TArray<uint8> FileData;
-			// FFileHelper::LoadFileToArray(FileData, *FilePath);
-
-			FPlatformProcess::Sleep(0.2f);
+			// Memory-mapped where supported, chunked async reads otherwise.
+			// Lines are parsed in parallel into views that point into the file data.
+			TUniquePtr<FStreamedTextFile> File = FStreamedTextFile::Load(FilePath);
+			if (!File)
+			{
+				return;
+			}
 
-			// Background: Parse data
-			UE_LOG(LogTemp, Log, TEXT("Parsing data..."));
-			TArray<FString> ParsedLines;
-			// Parse FileData into ParsedLines
+			UE_LOG(LogTemp, Log, TEXT("Parsed %d lines (read %.2f ms, parse %.2f ms)"),
+				File->GetLines().Num(), File->GetReadSeconds() * 1000.0, File->GetParseSeconds() * 1000.0);
 
-			FPlatformProcess::Sleep(0.1f);
+			if (Token.IsCancelled())
+			{
+				return;  // Superseded or component destroyed - the file is freed here, off the game thread
+			}
 
-			// Game thread: Apply to component
-			AsyncTask(ENamedThreads::GameThread, [WeakThis, ParsedLines]()
+			// Game thread: Apply to component - the file is moved, not copied
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Token, File = MoveTemp(File)]() mutable
 			{
-				if (WeakThis.IsValid())
+				UAsyncLoaderComponent* Component = WeakThis.Get();
+				if (Component && !Token.IsCancelled())
 				{
 					UE_LOG(LogTemp, Log, TEXT("Data loaded and parsed, applying to component"));
-					// WeakThis->ApplyData(ParsedLines);
-					// WeakThis->OnLoadComplete.Broadcast();
+					Component->ApplyData(MoveTemp(File));
+					// Component->OnLoadComplete.Broadcast();
 				}
 			});
 		});
 	}
+
+	void ApplyData(TUniquePtr<FStreamedTextFile> File)
+	{
+		// The component now owns the file data - the line views stay valid as long as it does
+		LoadedFile = MoveTemp(File);
+	}
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override
+	{
+		LoadCancellation.Cancel();  // Don't wait for GC to notice
+		Super::EndPlay(EndPlayReason);
+	}
+
+private:
+	TUniquePtr<FStreamedTextFile> LoadedFile;
+
+	// Cancels the in-flight load when a new one starts or the component is destroyed
+	FCancellationSource LoadCancellation;
 };
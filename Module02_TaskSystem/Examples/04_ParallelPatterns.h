@@ -5,6 +5,9 @@
 
 #include "CoreMinimal.h"
 #include "Tasks/Task.h"
+#include "05_BoundedChannel.h"
+#include "07_ParallelChunking.h"
+#include "19_ParallelSum.h"
 
 class FParallelPatterns
 {
@@ -87,55 +90,20 @@ public:
 			Numbers.Add(i);
 		}
 
-		const int32 NumWorkers = 4;
-		const int32 ItemsPerWorker = Numbers.Num() / NumWorkers;
+		// Small chunks so this tiny demo actually fans out; real data wants ~1000+ items per chunk
+		FParallelSumSettings Settings;
+		Settings.Policy.NumWorkers = 4;
+		Settings.Policy.MinChunkSize = 10;
 
-		// MAP PHASE: Process chunks in parallel
-		TArray<UE::Tasks::FTask> MapTasks;
-
-		for (int32 WorkerIdx = 0; WorkerIdx < NumWorkers; WorkerIdx++)
+		// MAP PHASE: each worker squares the chunks it claims and sums them into its own
+		// cache-line-padded int64 partial
+		// REDUCE PHASE: partials are combined once all chunks are done (see 19_ParallelSum.h)
+		const int64 Result = ParallelMapSum<int64>(Numbers.Num(), [&Numbers](int32 Index)
 		{
-			const int32 StartIdx = WorkerIdx * ItemsPerWorker;
-			const int32 EndIdx = (WorkerIdx == NumWorkers - 1)
-				? Numbers.Num()
-				: StartIdx + ItemsPerWorker;
+			return static_cast<int64>(Numbers[Index]) * Numbers[Index];  // Square - int64 before the multiply
+		}, Settings);
 
-			MapTasks.Add(UE::Tasks::Launch(
-				TEXT("MapTask"),
-				[&Numbers, StartIdx, EndIdx]() -> int32
-				{
-					int32 LocalSum = 0;
-					for (int32 i = StartIdx; i < EndIdx; i++)
-					{
-						LocalSum += Numbers[i] * Numbers[i];  // Square and sum
-					}
-
-					UE_LOG(LogTemp, Log, TEXT("Map task computed partial sum: %d"), LocalSum);
-					return LocalSum;
-				}
-			));
-		}
-
-		// REDUCE PHASE: Combine results
-		auto ReduceTask = UE::Tasks::Launch(
-			TEXT("ReduceTask"),
-			[MapTasks]() -> int32
-			{
-				int32 TotalSum = 0;
-
-				for (const UE::Tasks::FTask& MapTask : MapTasks)
-				{
-					TotalSum += MapTask.GetResult();
-				}
-
-				UE_LOG(LogTemp, Log, TEXT("Reduce task computed total: %d"), TotalSum);
-				return TotalSum;
-			},
-			UE::Tasks::Prerequisites(MapTasks)
-		);
-
-		int32 Result = ReduceTask.GetResult();
-		UE_LOG(LogTemp, Log, TEXT("Map-Reduce complete! Sum of squares: %d"), Result);
+		UE_LOG(LogTemp, Log, TEXT("Map-Reduce complete! Sum of squares: %lld"), Result);
 	}
 
 	// Example 3: Producer-Consumer Pattern
@@ -143,21 +111,24 @@ public:
 	{
 		UE_LOG(LogTemp, Log, TEXT("=== Producer-Consumer Pattern ==="));
 
-		// Thread-safe queue
-		TQueue<int32, EQueueMode::Mpsc> WorkQueue;  // Multi-producer, single-consumer
-		std::atomic<bool> bProducingComplete{false};
+		// Bounded, blocking channel (see 05_BoundedChannel.h)
+		// - Consumer sleeps on an event while empty instead of polling
+		// - Producers block while full (backpressure)
+		// - Close() replaces the "producing complete" flag
+		TBoundedChannel<int32> WorkChannel(16);
 
 		// Consumer task
-		auto ConsumerTask = UE::Tasks::Launch(TEXT("Consumer"), [&WorkQueue, &bProducingComplete]()
+		auto ConsumerTask = UE::Tasks::Launch(TEXT("Consumer"), [&WorkChannel]()
 		{
 			UE_LOG(LogTemp, Log, TEXT("Consumer started"));
 
 			TArray<int32> ProcessedItems;
+			TArray<int32> Batch;
 
-			while (!bProducingComplete || !WorkQueue.IsEmpty())
+			// PopBatch blocks until items arrive, returns 0 once closed and drained
+			while (WorkChannel.PopBatch(Batch, 8) > 0)
 			{
-				int32 Item;
-				if (WorkQueue.Dequeue(Item))
+				for (int32 Item : Batch)
 				{
 					// Process item
 					int32 Result = Item * Item;
@@ -165,10 +136,8 @@ public:
 
 					UE_LOG(LogTemp, Verbose, TEXT("Consumed item %d, result %d"), Item, Result);
 				}
-				else
-				{
-					FPlatformProcess::Sleep(0.001f);  // Brief sleep if queue empty
-				}
+
+				Batch.Reset();
 			}
 
 			UE_LOG(LogTemp, Log, TEXT("Consumer finished, processed %d items"), ProcessedItems.Num());
@@ -183,14 +152,14 @@ public:
 		{
 			ProducerTasks.Add(UE::Tasks::Launch(
 				TEXT("Producer"),
-				[&WorkQueue, ProducerIdx]()
+				[&WorkChannel, ProducerIdx]()
 				{
 					UE_LOG(LogTemp, Log, TEXT("Producer %d started"), ProducerIdx);
 
 					for (int32 i = 0; i < 10; i++)
 					{
 						int32 Item = ProducerIdx * 100 + i;
-						WorkQueue.Enqueue(Item);
+						WorkChannel.Push(Item);  // Blocks if the consumer falls behind
 
 						UE_LOG(LogTemp, Verbose, TEXT("Producer %d enqueued %d"), ProducerIdx, Item);
 
@@ -202,9 +171,9 @@ public:
 			));
 		}
 
-		// Wait for all producers to finish
+		// Wait for all producers to finish, then let the consumer drain and exit
 		UE::Tasks::Wait(ProducerTasks);
-		bProducingComplete = true;
+		WorkChannel.Close();
 
 		// Wait for consumer
 		TArray<int32> Results = ConsumerTask.GetResult();
@@ -217,81 +186,67 @@ public:
 		UE_LOG(LogTemp, Log, TEXT("=== Pipeline Pattern ==="));
 
 		// Three-stage pipeline: Generate → Transform → Aggregate
+		// Each stage closes its output channel when done - that is the completion signal
+		// (06_StreamingPipeline.h wraps this wiring in a reusable TPipeline builder)
 
-		TQueue<int32, EQueueMode::Spsc> Stage1To2Queue;
-		TQueue<int32, EQueueMode::Spsc> Stage2To3Queue;
-
-		std::atomic<bool> bStage1Complete{false};
-		std::atomic<bool> bStage2Complete{false};
+		TBoundedChannel<int32> Stage1To2Channel(8);
+		TBoundedChannel<int32> Stage2To3Channel(8);
 
 		// Stage 1: Generate numbers
-		auto Stage1 = UE::Tasks::Launch(TEXT("Stage1_Generate"), [&Stage1To2Queue, &bStage1Complete]()
+		auto Stage1 = UE::Tasks::Launch(TEXT("Stage1_Generate"), [&Stage1To2Channel]()
 		{
 			UE_LOG(LogTemp, Log, TEXT("Stage 1: Generating numbers"));
 
 			for (int32 i = 1; i <= 20; i++)
 			{
-				Stage1To2Queue.Enqueue(i);
+				Stage1To2Channel.Push(i);
 				FPlatformProcess::Sleep(0.01f);
 			}
 
-			bStage1Complete = true;
+			Stage1To2Channel.Close();
 			UE_LOG(LogTemp, Log, TEXT("Stage 1: Complete"));
 		});
 
 		// Stage 2: Transform (square numbers)
 		auto Stage2 = UE::Tasks::Launch(TEXT("Stage2_Transform"),
-			[&Stage1To2Queue, &Stage2To3Queue, &bStage1Complete, &bStage2Complete]()
+			[&Stage1To2Channel, &Stage2To3Channel]()
 		{
 			UE_LOG(LogTemp, Log, TEXT("Stage 2: Transforming numbers"));
 
-			while (!bStage1Complete || !Stage1To2Queue.IsEmpty())
+			int32 Input;
+			while (Stage1To2Channel.Pop(Input))  // Wakes as soon as Stage 1 pushes
 			{
-				int32 Input;
-				if (Stage1To2Queue.Dequeue(Input))
-				{
-					int32 Output = Input * Input;
-					Stage2To3Queue.Enqueue(Output);
-					UE_LOG(LogTemp, Verbose, TEXT("Stage 2: %d -> %d"), Input, Output);
-				}
-				else
-				{
-					FPlatformProcess::Sleep(0.001f);
-				}
+				int32 Output = Input * Input;
+				Stage2To3Channel.Push(Output);
+				UE_LOG(LogTemp, Verbose, TEXT("Stage 2: %d -> %d"), Input, Output);
 			}
 
-			bStage2Complete = true;
+			Stage2To3Channel.Close();
 			UE_LOG(LogTemp, Log, TEXT("Stage 2: Complete"));
 		});
 
 		// Stage 3: Aggregate (sum)
 		auto Stage3 = UE::Tasks::Launch(TEXT("Stage3_Aggregate"),
-			[&Stage2To3Queue, &bStage2Complete]() -> int32
+			[&Stage2To3Channel]() -> int32
 		{
 			UE_LOG(LogTemp, Log, TEXT("Stage 3: Aggregating results"));
 
 			int32 Sum = 0;
 
-			while (!bStage2Complete || !Stage2To3Queue.IsEmpty())
+			int32 Value;
+			while (Stage2To3Channel.Pop(Value))
 			{
-				int32 Value;
-				if (Stage2To3Queue.Dequeue(Value))
-				{
-					Sum += Value;
-					UE_LOG(LogTemp, Verbose, TEXT("Stage 3: Sum = %d"), Sum);
-				}
-				else
-				{
-					FPlatformProcess::Sleep(0.001f);
-				}
+				Sum += Value;
+				UE_LOG(LogTemp, Verbose, TEXT("Stage 3: Sum = %d"), Sum);
 			}
 
 			UE_LOG(LogTemp, Log, TEXT("Stage 3: Complete, Sum = %d"), Sum);
 			return Sum;
 		});
 
-		// Wait for pipeline
+		// Wait for pipeline (channels live on this stack frame, so every stage must finish)
 		int32 FinalResult = Stage3.GetResult();
+		UE::Tasks::Wait(TArray<UE::Tasks::FTask>{Stage1, Stage2});
 		UE_LOG(LogTemp, Log, TEXT("Pipeline complete! Final sum: %d"), FinalResult);
 	}
 
@@ -309,52 +264,19 @@ public:
 			DataPoints.Add(static_cast<float>(i));
 		}
 
-		// Calculate optimal batch size
-		const int32 NumWorkers = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
-		const int32 MinItemsPerBatch = 10000;  // Minimum to amortize task overhead
-		const int32 OptimalBatchSize = FMath::Max(MinItemsPerBatch, NumDataPoints / NumWorkers);
-
-		UE_LOG(LogTemp, Log, TEXT("Processing %d items, %d workers, batch size: %d"),
-			NumDataPoints, NumWorkers, OptimalBatchSize);
-
-		// Results (one array per batch to avoid synchronization)
-		TArray<TArray<float>> BatchResults;
-		const int32 NumBatches = (NumDataPoints + OptimalBatchSize - 1) / OptimalBatchSize;
-		BatchResults.SetNum(NumBatches);
+		// Guided chunking: workers claim shrinking chunks from a shared cursor, so uneven
+		// items can't leave one long batch running alone. MinChunkSize amortizes task overhead.
+		FParallelChunkPolicy Policy;
+		Policy.MinChunkSize = 10000;
 
-		TArray<UE::Tasks::FTask> Tasks;
+		UE_LOG(LogTemp, Log, TEXT("Processing %d items, %d workers, min chunk: %d"),
+			NumDataPoints, Policy.ResolveNumWorkers(NumDataPoints), Policy.MinChunkSize);
 
-		for (int32 BatchIdx = 0; BatchIdx < NumBatches; BatchIdx++)
+		// Output is allocated once and each chunk writes its own index range - no merge pass
+		TArray<float> FinalResults = ParallelTransform(DataPoints, [](float Value)
 		{
-			const int32 StartIdx = BatchIdx * OptimalBatchSize;
-			const int32 EndIdx = FMath::Min(StartIdx + OptimalBatchSize, NumDataPoints);
-
-			Tasks.Add(UE::Tasks::Launch(
-				TEXT("ProcessBatch"),
-				[&DataPoints, &BatchResults, BatchIdx, StartIdx, EndIdx]()
-				{
-					// Complex computation per item
-					for (int32 i = StartIdx; i < EndIdx; i++)
-					{
-						float Value = DataPoints[i];
-						float Result = FMath::Sin(Value) * FMath::Cos(Value) + FMath::Sqrt(Value);
-						BatchResults[BatchIdx].Add(Result);
-					}
-				}
-			));
-		}
-
-		// Wait for all batches
-		UE::Tasks::Wait(Tasks);
-
-		// Merge results
-		TArray<float> FinalResults;
-		FinalResults.Reserve(NumDataPoints);
-
-		for (const TArray<float>& Batch : BatchResults)
-		{
-			FinalResults.Append(Batch);
-		}
+			return FMath::Sin(Value) * FMath::Cos(Value) + FMath::Sqrt(Value);
+		}, Policy);
 
 		UE_LOG(LogTemp, Log, TEXT("Optimal batching complete! Processed %d items"), FinalResults.Num());
 	}
@@ -0,0 +1,370 @@
+// Example 5: Bounded Channel
+// A blocking, bounded work queue for producer-consumer and pipeline stages
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Event.h"
+#include "Misc/ScopeLock.h"
+#include "Tasks/Task.h"
+
+/*
+ * TBoundedChannel is a multi-producer, multi-consumer queue with a fixed capacity.
+ *
+ * Compared to polling a TQueue with FPlatformProcess::Sleep():
+ * - Consumers block on an event while the channel is empty (no spinning, no 1ms latency per hop)
+ * - Producers block while the channel is full (backpressure instead of unbounded growth)
+ * - Close() lets consumers drain what is left and then exit cleanly (no completion flags)
+ *
+ * The channel is lock-based: one critical section guards the ring buffer and two
+ * manual-reset events mirror the "not empty" and "not full" conditions. That keeps
+ * it correct for any number of producers and consumers, including the SPSC case.
+ *
+ * NOTE: A blocked Push/Pop parks the worker thread on an OS event. It doesn't burn CPU,
+ * but it does occupy a worker. Keep the number of blocking stages well below the
+ * number of task workers, or the tasks that would unblock them may never get scheduled.
+ *
+ * ElementType must be default constructible and movable.
+ */
+template<typename ElementType>
+class TBoundedChannel
+{
+public:
+	explicit TBoundedChannel(int32 InCapacity)
+		: Capacity(FMath::Max(1, InCapacity))
+		, NotEmptyEvent(FPlatformProcess::GetSynchEventFromPool(true))
+		, NotFullEvent(FPlatformProcess::GetSynchEventFromPool(true))
+	{
+		Ring.SetNum(Capacity);
+		NotFullEvent->Trigger();
+	}
+
+	~TBoundedChannel()
+	{
+		FPlatformProcess::ReturnSynchEventToPool(NotEmptyEvent);
+		FPlatformProcess::ReturnSynchEventToPool(NotFullEvent);
+	}
+
+	// Channels are shared by reference between tasks - never copied
+	TBoundedChannel(const TBoundedChannel&) = delete;
+	TBoundedChannel& operator=(const TBoundedChannel&) = delete;
+
+	// Blocks while the channel is full. Returns false if the channel was closed.
+	bool Push(ElementType Item)
+	{
+		for (;;)
+		{
+			{
+				FScopeLock Lock(&Mutex);
+
+				if (bClosed)
+				{
+					return false;
+				}
+
+				if (Count < Capacity)
+				{
+					PushLocked(MoveTemp(Item));
+					return true;
+				}
+			}
+
+			NotFullEvent->Wait();
+		}
+	}
+
+	// Never blocks. Returns false if the channel is full or closed (Item is left untouched).
+	bool TryPush(ElementType& Item)
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (bClosed || Count == Capacity)
+		{
+			return false;
+		}
+
+		PushLocked(MoveTemp(Item));
+		return true;
+	}
+
+	// Moves as many items as fit under one lock, blocking for space until all are pushed.
+	// Returns the number of items pushed (less than Items.Num() only if the channel closed).
+	int32 PushBatch(TArrayView<ElementType> Items)
+	{
+		int32 NumPushed = 0;
+
+		while (NumPushed < Items.Num())
+		{
+			{
+				FScopeLock Lock(&Mutex);
+
+				if (bClosed)
+				{
+					break;
+				}
+
+				while (Count < Capacity && NumPushed < Items.Num())
+				{
+					PushLocked(MoveTemp(Items[NumPushed++]));
+				}
+			}
+
+			if (NumPushed < Items.Num())
+			{
+				NotFullEvent->Wait();
+			}
+		}
+
+		return NumPushed;
+	}
+
+	// Blocks while the channel is empty.
+	// Returns false once the channel is closed AND drained - the consumer's exit condition.
+	bool Pop(ElementType& OutItem)
+	{
+		for (;;)
+		{
+			{
+				FScopeLock Lock(&Mutex);
+
+				if (Count > 0)
+				{
+					OutItem = PopLocked();
+					return true;
+				}
+
+				if (bClosed)
+				{
+					return false;
+				}
+			}
+
+			NotEmptyEvent->Wait();
+		}
+	}
+
+	// Never blocks. Returns false if nothing is available right now.
+	bool TryPop(ElementType& OutItem)
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (Count == 0)
+		{
+			return false;
+		}
+
+		OutItem = PopLocked();
+		return true;
+	}
+
+	// Blocks until at least one item is available, then takes up to MaxItems under one lock.
+	// Items are appended to OutItems. Returns 0 once the channel is closed and drained.
+	int32 PopBatch(TArray<ElementType>& OutItems, int32 MaxItems)
+	{
+		check(MaxItems > 0);
+
+		for (;;)
+		{
+			{
+				FScopeLock Lock(&Mutex);
+
+				if (Count > 0)
+				{
+					const int32 NumToPop = FMath::Min(Count, MaxItems);
+					OutItems.Reserve(OutItems.Num() + NumToPop);
+
+					for (int32 i = 0; i < NumToPop; i++)
+					{
+						OutItems.Add(PopLocked());
+					}
+
+					return NumToPop;
+				}
+
+				if (bClosed)
+				{
+					return 0;
+				}
+			}
+
+			NotEmptyEvent->Wait();
+		}
+	}
+
+	// No more pushes are accepted. Consumers keep receiving queued items, then Pop returns false.
+	void Close()
+	{
+		FScopeLock Lock(&Mutex);
+
+		bClosed = true;
+
+		// Wake everyone so blocked producers fail and blocked consumers drain/exit
+		NotEmptyEvent->Trigger();
+		NotFullEvent->Trigger();
+	}
+
+	bool IsClosed() const
+	{
+		FScopeLock Lock(&Mutex);
+		return bClosed;
+	}
+
+	// Snapshot only - may be stale by the time the caller looks at it
+	int32 Num() const
+	{
+		FScopeLock Lock(&Mutex);
+		return Count;
+	}
+
+	int32 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	// Highest Num() ever observed - useful to spot stages that can't keep up
+	int32 GetMaxDepth() const
+	{
+		FScopeLock Lock(&Mutex);
+		return MaxCount;
+	}
+
+private:
+	// Both helpers require Mutex to be held. The events are kept in sync with
+	// Count under the lock so a waiter can never miss a wakeup.
+	void PushLocked(ElementType&& Item)
+	{
+		Ring[(Head + Count) % Capacity] = MoveTemp(Item);
+		Count++;
+		MaxCount = FMath::Max(MaxCount, Count);
+
+		NotEmptyEvent->Trigger();
+		if (Count == Capacity)
+		{
+			NotFullEvent->Reset();
+		}
+	}
+
+	ElementType PopLocked()
+	{
+		ElementType Item = MoveTemp(Ring[Head]);
+		Head = (Head + 1) % Capacity;
+		Count--;
+
+		NotFullEvent->Trigger();
+		if (Count == 0 && !bClosed)
+		{
+			NotEmptyEvent->Reset();
+		}
+
+		return Item;
+	}
+
+	const int32 Capacity;
+	TArray<ElementType> Ring;
+	int32 Head = 0;
+	int32 Count = 0;
+	int32 MaxCount = 0;
+	bool bClosed = false;
+
+	mutable FCriticalSection Mutex;
+	FEvent* NotEmptyEvent;  // Triggered while Count > 0 or closed
+	FEvent* NotFullEvent;   // Triggered while Count < Capacity or closed
+};
+
+// Example usage
+class FBoundedChannelExamples
+{
+public:
+	// Example 1: Backpressure - a fast producer is throttled by a slow consumer
+	void BackpressureExample()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Bounded Channel: Backpressure ==="));
+
+		// Only 4 items can be in flight - the producer blocks instead of growing a queue
+		TBoundedChannel<int32> Channel(4);
+
+		auto Producer = UE::Tasks::Launch(TEXT("FastProducer"), [&Channel]()
+		{
+			for (int32 i = 0; i < 20; i++)
+			{
+				Channel.Push(i);  // Blocks while 4 items are waiting
+			}
+
+			// Tell the consumer nothing else is coming
+			Channel.Close();
+		});
+
+		auto Consumer = UE::Tasks::Launch(TEXT("SlowConsumer"), [&Channel]() -> int32
+		{
+			int32 Sum = 0;
+			int32 Item;
+
+			// Pop returns false only after Close() AND the channel is empty
+			while (Channel.Pop(Item))
+			{
+				FPlatformProcess::Sleep(0.005f);  // Simulate slow work
+				Sum += Item;
+			}
+
+			return Sum;
+		});
+
+		Producer.Wait();
+		UE_LOG(LogTemp, Log, TEXT("Consumer sum: %d (expected 190)"), Consumer.GetResult());
+	}
+
+	// Example 2: Batch transfer - amortize the lock over many items
+	void BatchExample()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Bounded Channel: Batches ==="));
+
+		TBoundedChannel<int32> Channel(64);
+
+		auto Producer = UE::Tasks::Launch(TEXT("BatchProducer"), [&Channel]()
+		{
+			TArray<int32> Batch;
+			for (int32 i = 0; i < 1000; i++)
+			{
+				Batch.Add(i);
+			}
+
+			// One call, blocks for space as needed
+			Channel.PushBatch(Batch);
+			Channel.Close();
+		});
+
+		auto Consumer = UE::Tasks::Launch(TEXT("BatchConsumer"), [&Channel]() -> int32
+		{
+			int32 NumReceived = 0;
+			TArray<int32> Batch;
+
+			while (Channel.PopBatch(Batch, 32) > 0)
+			{
+				NumReceived += Batch.Num();
+				Batch.Reset();
+			}
+
+			return NumReceived;
+		});
+
+		Producer.Wait();
+		UE_LOG(LogTemp, Log, TEXT("Received %d items in batches"), Consumer.GetResult());
+	}
+
+	// Example 3: WRONG - polling with sleep (what the channel replaces)
+	void PollingAntiPattern()
+	{
+		/* DON'T DO THIS:
+		while (!bProducingComplete || !Queue.IsEmpty())
+		{
+			if (!Queue.Dequeue(Item))
+			{
+				FPlatformProcess::Sleep(0.001f);  // Burns a worker and adds up to 1ms per hop
+			}
+		}
+		*/
+
+		// DO THIS:
+		// while (Channel.Pop(Item)) { ... }  // Sleeps on an event, wakes immediately on Push
+	}
+};
@@ -0,0 +1,385 @@
+// Example 6: Streaming Pipeline Builder
+// Typed, composable pipeline stages connected by bounded channels
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Fundamental/Scheduler.h"
+#include "Tasks/Task.h"
+#include "05_BoundedChannel.h"
+#include <atomic>
+#include <type_traits>
+
+/*
+ * TPipeline<InType, OutType> replaces hand-wired pipelines like FParallelPatterns::Pipeline():
+ *
+ *   auto Pipeline = MakePipeline<int32>()
+ *       .Then(TEXT("Parse"),  [](int32 Raw) { return Parse(Raw); })
+ *       .Then(TEXT("Solve"),  [](FParsed P) { return Solve(P); }, 4)   // Slow stage: 4 workers
+ *       .Filter(TEXT("Keep"), [](const FSolved& S) { return S.bValid; });
+ *
+ *   FPipelineStats Stats = Pipeline.Run(Producer, Sink);                     // Blocks until drained
+ *   UE::Tasks::TTask<FPipelineStats> Done = Pipeline.RunAsync(Producer, Sink); // Returns immediately
+ *
+ * - Every stage owns a bounded input buffer, so a slow stage applies backpressure upstream
+ * - A stage can run N workers pulling from the same buffer (output order is NOT preserved)
+ * - The stage's output buffer is closed when its last worker exits - no completion flags
+ * - Run() returns per-stage throughput, busy time and queue-depth high-water marks
+ *
+ * Stage functions are called concurrently when NumWorkers > 1, so they must be thread-safe.
+ */
+
+// Per-stage report filled in after a run
+struct FPipelineStageStats
+{
+	FString Name;
+	int32 NumWorkers = 0;
+	int64 ItemsIn = 0;
+	int64 ItemsOut = 0;
+	double BusySeconds = 0.0;      // Time spent inside the stage function, summed over workers
+	double WallSeconds = 0.0;      // Time from stage launch until its last worker exited
+	int32 InputCapacity = 0;
+	int32 MaxInputDepth = 0;       // Close to InputCapacity = this stage is the bottleneck
+
+	double GetItemsPerSecond() const
+	{
+		return WallSeconds > 0.0 ? ItemsOut / WallSeconds : 0.0;
+	}
+
+	// 1.0 = every worker was busy the whole time
+	double GetUtilization() const
+	{
+		return (WallSeconds > 0.0 && NumWorkers > 0) ? BusySeconds / (WallSeconds * NumWorkers) : 0.0;
+	}
+};
+
+struct FPipelineStats
+{
+	TArray<FPipelineStageStats> Stages;
+	double TotalSeconds = 0.0;
+	int64 ItemsOut = 0;
+
+	void LogStats() const
+	{
+		UE_LOG(LogTemp, Log, TEXT("Pipeline: %lld items in %.3fs"), ItemsOut, TotalSeconds);
+
+		for (const FPipelineStageStats& Stage : Stages)
+		{
+			UE_LOG(LogTemp, Log, TEXT("  [%s] workers=%d in=%lld out=%lld %.0f items/s util=%.0f%% queue=%d/%d"),
+				*Stage.Name, Stage.NumWorkers, Stage.ItemsIn, Stage.ItemsOut, Stage.GetItemsPerSecond(),
+				Stage.GetUtilization() * 100.0, Stage.MaxInputDepth, Stage.InputCapacity);
+		}
+	}
+};
+
+// Shared state for one Run() - stages register their tasks and counters here
+class FPipelineRunContext
+{
+public:
+	struct FStageCounters
+	{
+		FString Name;
+		int32 NumWorkers = 0;
+		std::atomic<int64> ItemsIn{0};
+		std::atomic<int64> ItemsOut{0};
+		std::atomic<uint64> BusyCycles{0};
+		std::atomic<int32> RemainingWorkers{0};
+		double LaunchSeconds = 0.0;
+		std::atomic<double> FinishSeconds{0.0};
+		TFunction<int32()> GetInputCapacity;
+		TFunction<int32()> GetMaxInputDepth;
+	};
+
+	TArray<UE::Tasks::FTask> Tasks;
+	TArray<TSharedRef<FStageCounters, ESPMode::ThreadSafe>> Stages;
+};
+
+template<typename InType, typename OutType>
+class TPipeline
+{
+public:
+	explicit TPipeline(int32 InBufferCapacity)
+		: BufferCapacity(FMath::Max(1, InBufferCapacity))
+	{
+	}
+
+	// Adds a 1:1 transform stage. The output type is deduced from StageFunc.
+	template<typename FuncType>
+	auto Then(const TCHAR* StageName, FuncType StageFunc, int32 NumWorkers = 1) const
+	{
+		using NewOutType = std::decay_t<std::invoke_result_t<FuncType&, OutType&&>>;
+
+		return AddStage<NewOutType>(StageName, NumWorkers,
+			[StageFunc](OutType&& Item, TBoundedChannel<NewOutType>& Output) mutable -> bool
+			{
+				return Output.Push(StageFunc(MoveTemp(Item)));
+			});
+	}
+
+	// Adds a stage that only forwards items for which Predicate returns true
+	template<typename PredicateType>
+	TPipeline<InType, OutType> Filter(const TCHAR* StageName, PredicateType Predicate, int32 NumWorkers = 1) const
+	{
+		return AddStage<OutType>(StageName, NumWorkers,
+			[Predicate](OutType&& Item, TBoundedChannel<OutType>& Output) mutable -> bool
+			{
+				return Predicate(static_cast<const OutType&>(Item)) && Output.Push(MoveTemp(Item));
+			});
+	}
+
+	/*
+	 * Runs the pipeline to completion and returns the stats. BLOCKING.
+	 *
+	 * Producer runs on its own task and pushes inputs into the first buffer; the buffer is
+	 * closed automatically when Producer returns. Sink is called for every output on the
+	 * CALLING thread, which waits until the pipeline drains - call Run() from a task, never
+	 * from the game thread. On the game thread use RunAsync().
+	 */
+	FPipelineStats Run(TFunction<void(TBoundedChannel<InType>&)> Producer, TFunctionRef<void(OutType&&)> Sink) const
+	{
+		const double StartSeconds = FPlatformTime::Seconds();
+
+		FPipelineRunContext Context;
+		TSharedRef<TBoundedChannel<InType>, ESPMode::ThreadSafe> Source =
+			MakeShared<TBoundedChannel<InType>, ESPMode::ThreadSafe>(BufferCapacity);
+
+		TChannelRef<OutType> Output = LaunchStages(Source, Context);
+
+		WarnIfOversubscribed(Context);
+
+		UE::Tasks::FTask ProducerTask = UE::Tasks::Launch(TEXT("PipelineSource"),
+			[Source, Producer = MoveTemp(Producer)]()
+			{
+				Producer(*Source);
+				Source->Close();
+			});
+
+		FPipelineStats Stats;
+
+		OutType Item;
+		while (Output->Pop(Item))
+		{
+			Sink(MoveTemp(Item));
+			Stats.ItemsOut++;
+		}
+
+		ProducerTask.Wait();
+		UE::Tasks::Wait(Context.Tasks);
+
+		Stats.TotalSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+		for (const TSharedRef<FPipelineRunContext::FStageCounters, ESPMode::ThreadSafe>& Counters : Context.Stages)
+		{
+			FPipelineStageStats& Stage = Stats.Stages.AddDefaulted_GetRef();
+			Stage.Name = Counters->Name;
+			Stage.NumWorkers = Counters->NumWorkers;
+			Stage.ItemsIn = Counters->ItemsIn;
+			Stage.ItemsOut = Counters->ItemsOut;
+			Stage.BusySeconds = FPlatformTime::ToSeconds64(Counters->BusyCycles);
+			Stage.WallSeconds = Counters->FinishSeconds - Counters->LaunchSeconds;
+			Stage.InputCapacity = Counters->GetInputCapacity();
+			Stage.MaxInputDepth = Counters->GetMaxInputDepth();
+		}
+
+		return Stats;
+	}
+
+	// Convenience overload: feed an array of inputs
+	FPipelineStats Run(TArray<InType> Inputs, TFunctionRef<void(OutType&&)> Sink) const
+	{
+		return Run([Inputs = MoveTemp(Inputs)](TBoundedChannel<InType>& Channel) mutable
+		{
+			Channel.PushBatch(Inputs);
+		}, Sink);
+	}
+
+	// Non-blocking Run(): the whole run happens on a task, which completes with the stats.
+	// Sink is still called from one thread only, but it outlives this call - capture by value.
+	UE::Tasks::TTask<FPipelineStats> RunAsync(TFunction<void(TBoundedChannel<InType>&)> Producer, TFunction<void(OutType&&)> Sink) const
+	{
+		return UE::Tasks::Launch(TEXT("PipelineRun"),
+			[Pipeline = *this, Producer = MoveTemp(Producer), Sink = MoveTemp(Sink)]() mutable
+			{
+				return Pipeline.Run(MoveTemp(Producer), Sink);
+			});
+	}
+
+private:
+	template<typename, typename>
+	friend class TPipeline;
+
+	template<typename T>
+	using TChannelRef = TSharedRef<TBoundedChannel<T>, ESPMode::ThreadSafe>;
+
+	// Launches this pipeline's stages reading from Source and returns the last stage's output
+	using FLauncher = TFunction<TChannelRef<OutType>(TChannelRef<InType>, FPipelineRunContext&)>;
+
+	TChannelRef<OutType> LaunchStages(TChannelRef<InType> Source, FPipelineRunContext& Context) const
+	{
+		if constexpr (std::is_same_v<InType, OutType>)
+		{
+			if (!Launcher)
+			{
+				return Source;  // No stages yet - the source buffer is the output
+			}
+		}
+
+		return Launcher(Source, Context);
+	}
+
+	template<typename NewOutType, typename ProcessType>
+	TPipeline<InType, NewOutType> AddStage(const TCHAR* StageName, int32 NumWorkers, ProcessType Process) const
+	{
+		TPipeline<InType, NewOutType> Result(BufferCapacity);
+
+		Result.Launcher = [Upstream = *this, Capacity = BufferCapacity, Name = FString(StageName),
+			NumWorkers = FMath::Max(1, NumWorkers), Process]
+			(TChannelRef<InType> Source, FPipelineRunContext& Context) -> TChannelRef<NewOutType>
+		{
+			TChannelRef<OutType> Input = Upstream.LaunchStages(Source, Context);
+
+			TChannelRef<NewOutType> Output = MakeShared<TBoundedChannel<NewOutType>, ESPMode::ThreadSafe>(Capacity);
+
+			LaunchStageWorkers<NewOutType>(Name, NumWorkers, Input, Output, Process, Context);
+			return Output;
+		};
+
+		return Result;
+	}
+
+	template<typename NewOutType, typename ProcessType>
+	static void LaunchStageWorkers(const FString& Name, int32 NumWorkers, TChannelRef<OutType> Input,
+		TChannelRef<NewOutType> Output, const ProcessType& Process, FPipelineRunContext& Context)
+	{
+		TSharedRef<FPipelineRunContext::FStageCounters, ESPMode::ThreadSafe> Counters =
+			MakeShared<FPipelineRunContext::FStageCounters, ESPMode::ThreadSafe>();
+		Counters->Name = Name;
+		Counters->NumWorkers = NumWorkers;
+		Counters->RemainingWorkers = NumWorkers;
+		Counters->LaunchSeconds = FPlatformTime::Seconds();
+		Counters->GetInputCapacity = [Input]() { return Input->GetCapacity(); };
+		Counters->GetMaxInputDepth = [Input]() { return Input->GetMaxDepth(); };
+		Context.Stages.Add(Counters);
+
+		for (int32 WorkerIdx = 0; WorkerIdx < NumWorkers; WorkerIdx++)
+		{
+			// Each worker gets its own copy of Process; the stage function inside must be thread-safe
+			Context.Tasks.Add(UE::Tasks::Launch(*Counters->Name, [Input, Output, Counters, Process]() mutable
+			{
+				OutType Item;
+				while (Input->Pop(Item))
+				{
+					Counters->ItemsIn++;
+
+					const uint64 StartCycles = FPlatformTime::Cycles64();
+					const bool bEmitted = Process(MoveTemp(Item), *Output);
+					Counters->BusyCycles += FPlatformTime::Cycles64() - StartCycles;
+
+					if (bEmitted)
+					{
+						Counters->ItemsOut++;
+					}
+				}
+
+				// Last worker out closes the next buffer - that is downstream's completion signal
+				if (--Counters->RemainingWorkers == 0)
+				{
+					Counters->FinishSeconds = FPlatformTime::Seconds();
+					Output->Close();
+				}
+			}));
+		}
+	}
+
+	static void WarnIfOversubscribed(const FPipelineRunContext& Context)
+	{
+		// Every stage worker (plus the producer) blocks on a channel. If they outnumber the
+		// task workers, a stage may never get a thread and the pipeline deadlocks.
+		int32 NumBlockingTasks = 1;
+		for (const TSharedRef<FPipelineRunContext::FStageCounters, ESPMode::ThreadSafe>& Counters : Context.Stages)
+		{
+			NumBlockingTasks += Counters->NumWorkers;
+		}
+
+		const int32 NumTaskWorkers = static_cast<int32>(LowLevelTasks::FScheduler::Get().GetNumWorkers());
+		if (NumBlockingTasks >= NumTaskWorkers)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Pipeline uses %d blocking tasks but only %d task workers exist - reduce NumWorkers"),
+				NumBlockingTasks, NumTaskWorkers);
+		}
+	}
+
+	int32 BufferCapacity;
+	FLauncher Launcher;  // Unset for a pipeline with no stages
+};
+
+// Entry point: a pipeline with no stages yet. BufferCapacity applies to every stage's input.
+template<typename InType>
+TPipeline<InType, InType> MakePipeline(int32 BufferCapacity = 64)
+{
+	return TPipeline<InType, InType>(BufferCapacity);
+}
+
+// Example usage
+class FStreamingPipelineExamples
+{
+public:
+	// Example 1: FParallelPatterns::Pipeline() rebuilt with the builder
+	void GenerateTransformAggregate()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Streaming Pipeline: Generate -> Transform -> Aggregate ==="));
+
+		auto Pipeline = MakePipeline<int32>(8)
+			.Then(TEXT("Square"), [](int32 Value) { return Value * Value; });
+
+		int32 Sum = 0;
+
+		FPipelineStats Stats = Pipeline.Run(
+			[](TBoundedChannel<int32>& Source)
+			{
+				for (int32 i = 1; i <= 20; i++)
+				{
+					Source.Push(i);
+					FPlatformProcess::Sleep(0.01f);
+				}
+			},
+			[&Sum](int32&& Value)
+			{
+				Sum += Value;  // Sink runs on this thread - no synchronization needed
+			});
+
+		Stats.LogStats();
+		UE_LOG(LogTemp, Log, TEXT("Pipeline complete! Final sum: %d"), Sum);
+	}
+
+	// Example 2: Scale only the slow middle stage across cores
+	void ScaleSlowStage()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Streaming Pipeline: Scaling A Slow Stage ==="));
+
+		TArray<int32> Inputs;
+		for (int32 i = 0; i < 200; i++)
+		{
+			Inputs.Add(i);
+		}
+
+		auto Pipeline = MakePipeline<int32>(32)
+			.Then(TEXT("Parse"), [](int32 Value) { return static_cast<float>(Value); })
+			.Then(TEXT("Simulate"), [](float Value)
+			{
+				FPlatformProcess::Sleep(0.002f);  // The expensive stage
+				return FMath::Sqrt(Value);
+			}, 4)                                  // Only this stage gets 4 workers
+			.Filter(TEXT("KeepLarge"), [](const float& Value) { return Value > 5.0f; });
+
+		float Total = 0.0f;
+		FPipelineStats Stats = Pipeline.Run(MoveTemp(Inputs), [&Total](float&& Value)
+		{
+			Total += Value;
+		});
+
+		// Look for the stage with utilization near 100% and a full input queue
+		Stats.LogStats();
+		UE_LOG(LogTemp, Log, TEXT("Kept %lld values, total %.2f"), Stats.ItemsOut, Total);
+	}
+};
@@ -0,0 +1,270 @@
+// Example 7: Adaptive Chunking Helpers
+// ParallelForChunked / ParallelTransform / ParallelReduce with guided scheduling
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+#include <atomic>
+#include <type_traits>
+
+/*
+ * Hand-rolled batching (NumCores batches of Num / NumCores items) has two problems:
+ *
+ * 1. Long tails - if some items are more expensive than others, one batch finishes late
+ *    and every other core sits idle waiting for it.
+ * 2. Merge copies - writing each batch into its own TArray with Add() grows arrays in
+ *    the hot loop and needs a final Append() pass over all results.
+ *
+ * These helpers fix both:
+ *
+ * - GUIDED SCHEDULING: workers repeatedly claim the next chunk from a shared atomic cursor.
+ *   Chunks start large (Remaining / (Workers * GuidedDivisor)) and shrink as work runs out,
+ *   so the last chunks are small and all workers finish at roughly the same time.
+ *   Chunks never drop below MinChunkSize, which keeps claim overhead negligible.
+ * - PRESIZED OUTPUT: ParallelTransform sizes the output once and each chunk writes to its
+ *   own index range, so there is nothing to merge.
+ * - The calling thread works too, instead of just blocking in Wait().
+ */
+
+struct FParallelChunkPolicy
+{
+	// Smallest chunk handed to a worker - amortizes the cost of claiming a chunk
+	int32 MinChunkSize = 1024;
+
+	// Worker count; 0 = one per hardware thread
+	int32 NumWorkers = 0;
+
+	// Larger = smaller early chunks, better balance for uneven work, more claims
+	int32 GuidedDivisor = 2;
+
+	// Chunk sizes are rounded down to a multiple of this, so every chunk but the last starts
+	// and ends on it. Vector kernels set it to their lane count to keep the scalar tail in
+	// the final chunk.
+	int32 ChunkAlignment = 1;
+
+	int32 ResolveNumWorkers(int32 Num) const
+	{
+		const int32 MaxWorkers = NumWorkers > 0 ? NumWorkers : FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+		const int32 MinChunk = FMath::Max(1, MinChunkSize);
+
+		// Never launch more workers than there are minimum-size chunks
+		return FMath::Clamp(FMath::DivideAndRoundUp(Num, MinChunk), 1, FMath::Max(1, MaxWorkers));
+	}
+};
+
+namespace ParallelChunkingPrivate
+{
+	// Claims [OutStart, OutEnd) from the cursor. Returns false when no work is left.
+	inline bool ClaimChunk(std::atomic<int32>& Cursor, int32 Num, int32 NumWorkers,
+		const FParallelChunkPolicy& Policy, int32& OutStart, int32& OutEnd)
+	{
+		int32 Start = Cursor.load(std::memory_order_relaxed);
+
+		for (;;)
+		{
+			if (Start >= Num)
+			{
+				return false;
+			}
+
+			const int32 Remaining = Num - Start;
+			const int32 GuidedSize = Remaining / (NumWorkers * FMath::Max(1, Policy.GuidedDivisor));
+			const int32 Alignment = FMath::Max(1, Policy.ChunkAlignment);
+			const int32 UnalignedSize = FMath::Max(FMath::Max(1, Policy.MinChunkSize), GuidedSize);
+			const int32 ChunkSize = FMath::Min(Remaining, FMath::Max(Alignment, UnalignedSize / Alignment * Alignment));
+
+			// On failure Start is reloaded with the current cursor and we try again
+			if (Cursor.compare_exchange_weak(Start, Start + ChunkSize, std::memory_order_relaxed))
+			{
+				OutStart = Start;
+				OutEnd = Start + ChunkSize;
+				return true;
+			}
+		}
+	}
+}
+
+// Calls Body(StartIdx, EndIdx, WorkerIdx) for chunks covering [0, Num).
+// WorkerIdx is in [0, NumWorkers) and is stable for the lifetime of one worker, so it can
+// index per-worker scratch data. Blocks until every chunk has been processed.
+template<typename BodyType>
+void ParallelForChunked(int32 Num, BodyType&& Body, const FParallelChunkPolicy& Policy = FParallelChunkPolicy())
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	const int32 NumWorkers = Policy.ResolveNumWorkers(Num);
+
+	if (NumWorkers == 1)
+	{
+		// Too little work to be worth a task
+		Body(0, Num, 0);
+		return;
+	}
+
+	std::atomic<int32> Cursor{0};
+
+	auto RunWorker = [&Cursor, &Body, &Policy, Num, NumWorkers](int32 WorkerIdx)
+	{
+		int32 StartIdx, EndIdx;
+		while (ParallelChunkingPrivate::ClaimChunk(Cursor, Num, NumWorkers, Policy, StartIdx, EndIdx))
+		{
+			Body(StartIdx, EndIdx, WorkerIdx);
+		}
+	};
+
+	TArray<UE::Tasks::FTask> Tasks;
+	Tasks.Reserve(NumWorkers - 1);
+
+	for (int32 WorkerIdx = 1; WorkerIdx < NumWorkers; WorkerIdx++)
+	{
+		Tasks.Add(UE::Tasks::Launch(TEXT("ChunkWorker"), [&RunWorker, WorkerIdx]()
+		{
+			RunWorker(WorkerIdx);
+		}));
+	}
+
+	// The calling thread is worker 0
+	RunWorker(0);
+
+	UE::Tasks::Wait(Tasks);
+}
+
+// Output[i] = Func(Input[i]). Output must already have Input.Num() elements.
+template<typename InType, typename OutType, typename FuncType>
+void ParallelTransform(TConstArrayView<InType> Input, TArrayView<OutType> Output, FuncType&& Func,
+	const FParallelChunkPolicy& Policy = FParallelChunkPolicy())
+{
+	check(Output.Num() == Input.Num());
+
+	ParallelForChunked(Input.Num(), [Input, Output, &Func](int32 StartIdx, int32 EndIdx, int32)
+	{
+		for (int32 i = StartIdx; i < EndIdx; i++)
+		{
+			Output[i] = Func(Input[i]);
+		}
+	}, Policy);
+}
+
+// Returns a new array with Func applied to every element - allocated once, never merged
+template<typename InType, typename FuncType>
+auto ParallelTransform(const TArray<InType>& Input, FuncType&& Func, const FParallelChunkPolicy& Policy = FParallelChunkPolicy())
+{
+	using OutType = std::decay_t<std::invoke_result_t<FuncType&, const InType&>>;
+
+	TArray<OutType> Output;
+	if constexpr (std::is_trivially_default_constructible_v<OutType>)
+	{
+		Output.SetNumUninitialized(Input.Num());  // Every element is written below
+	}
+	else
+	{
+		Output.SetNum(Input.Num());
+	}
+
+	ParallelTransform<InType, OutType>(Input, Output, Func, Policy);
+	return Output;
+}
+
+// One value per cache line - for per-worker slots that are written concurrently
+template<typename T>
+struct alignas(PLATFORM_CACHE_LINE_SIZE) TCacheLinePadded
+{
+	T Value;
+};
+
+/*
+ * Map-reduce over [0, Num):
+ *   ChunkFunc(StartIdx, EndIdx, Accumulator&)  - accumulate one chunk into a per-worker accumulator
+ *   CombineFunc(AccType A, AccType B) -> AccType - merge two accumulators (must be associative)
+ *
+ * Every worker accumulator starts as Identity. Partials are combined in worker order.
+ * Each accumulator sits in its own cache line, so workers updating neighbouring partials
+ * don't invalidate each other's line on every write (false sharing).
+ */
+template<typename AccType, typename ChunkFuncType, typename CombineFuncType>
+AccType ParallelReduce(int32 Num, const AccType& Identity, ChunkFuncType&& ChunkFunc, CombineFuncType&& CombineFunc,
+	const FParallelChunkPolicy& Policy = FParallelChunkPolicy())
+{
+	const int32 NumWorkers = Policy.ResolveNumWorkers(Num);
+
+	TArray<TCacheLinePadded<AccType>> Partials;
+	Partials.Init(TCacheLinePadded<AccType>{Identity}, NumWorkers);
+
+	FParallelChunkPolicy WorkerPolicy = Policy;
+	WorkerPolicy.NumWorkers = NumWorkers;
+
+	ParallelForChunked(Num, [&Partials, &ChunkFunc](int32 StartIdx, int32 EndIdx, int32 WorkerIdx)
+	{
+		ChunkFunc(StartIdx, EndIdx, Partials[WorkerIdx].Value);
+	}, WorkerPolicy);
+
+	AccType Result = Identity;
+	for (const TCacheLinePadded<AccType>& Partial : Partials)
+	{
+		Result = CombineFunc(Result, Partial.Value);
+	}
+
+	return Result;
+}
+
+// Example usage
+class FParallelChunkingExamples
+{
+public:
+	// Example 1: Uneven work - guided chunks avoid the long tail
+	void UnevenWorkExample()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Adaptive Chunking: Uneven Work ==="));
+
+		TArray<int32> Iterations;
+		for (int32 i = 0; i < 100000; i++)
+		{
+			// The last items are 100x more expensive - a static split would leave one batch running alone
+			Iterations.Add(i < 90000 ? 10 : 1000);
+		}
+
+		FParallelChunkPolicy Policy;
+		Policy.MinChunkSize = 256;
+		Policy.GuidedDivisor = 4;  // Smaller early chunks for very uneven work
+
+		TArray<float> Results = ParallelTransform(Iterations, [](int32 Count)
+		{
+			float Value = 0.0f;
+			for (int32 i = 0; i < Count; i++)
+			{
+				Value += FMath::Sin(static_cast<float>(i));
+			}
+			return Value;
+		}, Policy);
+
+		UE_LOG(LogTemp, Log, TEXT("Processed %d items"), Results.Num());
+	}
+
+	// Example 2: Reduction - per-worker accumulators, no locks, no per-item atomics
+	void ReduceExample()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Adaptive Chunking: Reduce ==="));
+
+		TArray<float> Values;
+		for (int32 i = 0; i < 1000000; i++)
+		{
+			Values.Add(static_cast<float>(i % 100));
+		}
+
+		const float Max = ParallelReduce(Values.Num(), TNumericLimits<float>::Lowest(),
+			[&Values](int32 StartIdx, int32 EndIdx, float& LocalMax)
+			{
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					LocalMax = FMath::Max(LocalMax, Values[i]);
+				}
+			},
+			[](float A, float B) { return FMath::Max(A, B); });
+
+		UE_LOG(LogTemp, Log, TEXT("Max value: %.1f"), Max);
+	}
+};
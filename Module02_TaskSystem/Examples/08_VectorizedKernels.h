@@ -0,0 +1,233 @@
+// Example 8: Vectorized Kernels
+// In-core parallelism with VectorRegister4Float, combined with multicore chunking
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+#include "07_ParallelChunking.h"
+
+/*
+ * Tasks spread work across cores. SIMD spreads it across the lanes of one core:
+ * a VectorRegister4Float holds 4 floats and one VectorMultiply() does 4 multiplies.
+ *
+ * Unreal's vector layer (VectorLoad, VectorMultiply, VectorSin, VectorSqrt, ...) maps to
+ * SSE on x64 and NEON on ARM at compile time, so the same kernel runs on every platform.
+ *
+ * A vectorized kernel has three parts:
+ * 1. MAIN LOOP - 4 elements per iteration (here unrolled to 8 so two independent
+ *    registers are in flight and the CPU can overlap their latencies)
+ * 2. SCALAR TAIL - the last Num % 4 elements, processed one at a time
+ * 3. DISPATCH - choose the vector or scalar path at runtime
+ *
+ * Combine it with ParallelForChunked: each chunk runs the vector kernel over its range.
+ * Guided chunk sizes are arbitrary, so set the policy's ChunkAlignment to 8 (as
+ * ParallelSqrtSinSquare does) - then only the final chunk has a scalar tail.
+ *
+ * NOTE: VectorSin uses a polynomial approximation, so results can differ from
+ * FMath::Sin in the last few bits. Don't compare vector and scalar results with ==.
+ */
+
+enum class EFloatKernelPath : uint8
+{
+	Auto,    // Vector when the platform has vector intrinsics, scalar otherwise
+	Scalar,  // One float at a time - the reference implementation
+	Vector   // VectorRegister4Float main loop + scalar tail
+};
+
+namespace FloatKernels
+{
+	inline EFloatKernelPath ResolvePath(EFloatKernelPath Path)
+	{
+		if (Path != EFloatKernelPath::Auto)
+		{
+			return Path;
+		}
+
+		// Without intrinsics the vector functions are emulated with 4 scalar ops each
+		return PLATFORM_ENABLE_VECTORINTRINSICS ? EFloatKernelPath::Vector : EFloatKernelPath::Scalar;
+	}
+
+	inline const TCHAR* PathToString(EFloatKernelPath Path)
+	{
+		switch (Path)
+		{
+		case EFloatKernelPath::Scalar: return TEXT("Scalar");
+		case EFloatKernelPath::Vector: return TEXT("Vector");
+		default:                       return TEXT("Auto");
+		}
+	}
+
+	/*
+	 * Output[i] = Op(Input[i]) over the first Num elements.
+	 *   VectorOp(VectorRegister4Float) -> VectorRegister4Float
+	 *   ScalarOp(float) -> float - must compute the same function, used for the tail
+	 *
+	 * Loads and stores are unaligned, so any sub-range of a TArray can be passed.
+	 * Input and Output may be the same array (in-place), but must not partially overlap.
+	 */
+	template<typename VectorOpType, typename ScalarOpType>
+	void TransformVectorized(const float* Input, float* Output, int32 Num, VectorOpType&& VectorOp, ScalarOpType&& ScalarOp)
+	{
+		int32 i = 0;
+
+		// Main loop: two registers per iteration
+		for (; i + 8 <= Num; i += 8)
+		{
+			const VectorRegister4Float A = VectorLoad(Input + i);
+			const VectorRegister4Float B = VectorLoad(Input + i + 4);
+			VectorStore(VectorOp(A), Output + i);
+			VectorStore(VectorOp(B), Output + i + 4);
+		}
+
+		// One more register if 4-7 elements remain
+		if (i + 4 <= Num)
+		{
+			VectorStore(VectorOp(VectorLoad(Input + i)), Output + i);
+			i += 4;
+		}
+
+		// Scalar tail: 0-3 elements
+		for (; i < Num; i++)
+		{
+			Output[i] = ScalarOp(Input[i]);
+		}
+	}
+
+	// Scalar reference: Sqrt(Sin(X * X))
+	FORCEINLINE float SqrtSinSquare(float Value)
+	{
+		return FMath::Sqrt(FMath::Sin(Value * Value));
+	}
+
+	FORCEINLINE VectorRegister4Float SqrtSinSquare(const VectorRegister4Float& Value)
+	{
+		return VectorSqrt(VectorSin(VectorMultiply(Value, Value)));
+	}
+
+	// Sqrt(Sin(X * X)) over a range on the calling thread, using the requested path
+	inline void SqrtSinSquare(TConstArrayView<float> Input, TArrayView<float> Output, EFloatKernelPath Path = EFloatKernelPath::Auto)
+	{
+		check(Output.Num() == Input.Num());
+
+		if (ResolvePath(Path) == EFloatKernelPath::Vector)
+		{
+			TransformVectorized(Input.GetData(), Output.GetData(), Input.Num(),
+				[](const VectorRegister4Float& V) { return SqrtSinSquare(V); },
+				[](float V) { return SqrtSinSquare(V); });
+		}
+		else
+		{
+			for (int32 i = 0; i < Input.Num(); i++)
+			{
+				Output[i] = SqrtSinSquare(Input[i]);
+			}
+		}
+	}
+
+	// Multicore + SIMD: guided chunks across workers, vector kernel inside each chunk
+	inline void ParallelSqrtSinSquare(TConstArrayView<float> Input, TArrayView<float> Output,
+		EFloatKernelPath Path = EFloatKernelPath::Auto, const FParallelChunkPolicy& Policy = FParallelChunkPolicy())
+	{
+		check(Output.Num() == Input.Num());
+
+		const EFloatKernelPath ResolvedPath = ResolvePath(Path);
+
+		// Chunk boundaries on the 8-wide main loop - only the last chunk has a scalar tail
+		FParallelChunkPolicy AlignedPolicy = Policy;
+		AlignedPolicy.ChunkAlignment = FMath::Max(AlignedPolicy.ChunkAlignment, 8);
+
+		ParallelForChunked(Input.Num(), [Input, Output, ResolvedPath](int32 StartIdx, int32 EndIdx, int32)
+		{
+			SqrtSinSquare(Input.Slice(StartIdx, EndIdx - StartIdx), Output.Slice(StartIdx, EndIdx - StartIdx), ResolvedPath);
+		}, AlignedPolicy);
+	}
+}
+
+// Example usage
+class FVectorizedKernelExamples
+{
+public:
+	// Example 1: Scalar vs vector on one thread
+	void SingleThreadComparison()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Vectorized Kernels: Scalar vs Vector ==="));
+
+		TArray<float> Input;
+		Input.SetNumUninitialized(1000003);  // Not a multiple of 4 - exercises the tail
+		for (int32 i = 0; i < Input.Num(); i++)
+		{
+			Input[i] = static_cast<float>(i % 1000) * 0.001f;
+		}
+
+		TArray<float> ScalarOut, VectorOut;
+		ScalarOut.SetNumUninitialized(Input.Num());
+		VectorOut.SetNumUninitialized(Input.Num());
+
+		double Start = FPlatformTime::Seconds();
+		FloatKernels::SqrtSinSquare(Input, ScalarOut, EFloatKernelPath::Scalar);
+		const double ScalarMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		FloatKernels::SqrtSinSquare(Input, VectorOut, EFloatKernelPath::Vector);
+		const double VectorMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// Compare with a tolerance - VectorSin is an approximation
+		float MaxError = 0.0f;
+		for (int32 i = 0; i < Input.Num(); i++)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(ScalarOut[i] - VectorOut[i]));
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Scalar: %.2f ms, Vector: %.2f ms (%.1fx), max error %g"),
+			ScalarMs, VectorMs, VectorMs > 0.0 ? ScalarMs / VectorMs : 0.0, MaxError);
+	}
+
+	// Example 2: Both kinds of parallelism - chunks across cores, SIMD inside each chunk
+	void MulticoreAndSimd()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Vectorized Kernels: Multicore + SIMD ==="));
+
+		TArray<float> Input;
+		Input.SetNumUninitialized(4000000);
+		for (int32 i = 0; i < Input.Num(); i++)
+		{
+			Input[i] = static_cast<float>(i % 1000) * 0.001f;
+		}
+
+		TArray<float> Output;
+		Output.SetNumUninitialized(Input.Num());
+
+		FParallelChunkPolicy Policy;
+		Policy.MinChunkSize = 4096;  // Chunks are aligned to 8 by the kernel itself
+
+		FloatKernels::ParallelSqrtSinSquare(Input, Output, EFloatKernelPath::Auto, Policy);
+
+		UE_LOG(LogTemp, Log, TEXT("Processed %d floats on %d workers using the %s path"),
+			Output.Num(), Policy.ResolveNumWorkers(Input.Num()),
+			FloatKernels::PathToString(FloatKernels::ResolvePath(EFloatKernelPath::Auto)));
+	}
+
+	// Example 3: WRONG - things that stop a loop from vectorizing
+	void VectorizationBlockers()
+	{
+		/* DON'T DO THIS:
+		for (int32 i = 0; i < Input.Num(); i++)
+		{
+			Results.Add(ComplexCalculation(Input[i]));  // Add() may reallocate - a branch and a call per element
+		}
+
+		for (int32 i = 0; i < Input.Num(); i++)
+		{
+			if (Input[i] > 0.5f)                        // Data-dependent branch per element
+			{
+				Output[i] = FMath::Sin(Input[i]);
+			}
+		}
+		*/
+
+		// DO THIS:
+		// Presize the output, process whole registers, and use VectorSelect(Mask, A, B)
+		// instead of per-element branches inside the main loop
+	}
+};
@@ -0,0 +1,339 @@
+// Example 9: Streaming File Loader
+// Memory-mapped (or chunked async) reads with parallel, zero-copy line parsing
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/AsyncFileHandle.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "07_ParallelChunking.h"
+
+/*
+ * The naive way to load a text file costs three full copies:
+ *   LoadFileToArray   -> TArray<uint8>   (copy 1: disk to buffer)
+ *   parse into lines  -> TArray<FString> (copy 2: every line re-allocated, converted to TCHAR)
+ *   capture by value  -> game thread     (copy 3: the whole TArray<FString> again)
+ *
+ * FStreamedTextFile removes all three:
+ *
+ * 1. READ - map the file with IMappedFileHandle where the platform supports it, so the
+ *    OS pages it in on demand and nothing is copied. Otherwise read it with
+ *    IAsyncReadFileHandle in fixed-size chunks with several requests in flight,
+ *    straight into one presized buffer.
+ * 2. PARSE - split the bytes into line-aligned chunks and find line breaks in parallel.
+ *    Each line is an FUtf8StringView pointing into the mapped region or buffer.
+ * 3. HANDOFF - the whole result is owned by one TUniquePtr, which is moved (not copied)
+ *    into the game thread lambda. Moving it doesn't move the bytes, so the views stay valid.
+ *
+ * NOTE: Line views are UTF-8 and only valid while the FStreamedTextFile is alive.
+ * Convert the few lines you keep with FString(Line) - don't convert the whole file.
+ */
+
+struct FStreamedTextFileOptions
+{
+	// Try IMappedFileHandle first; false forces the chunked async read path
+	bool bAllowMapping = true;
+
+	// Chunked read path: bytes per request and requests kept in flight
+	int64 ReadChunkSize = 1024 * 1024;
+	int32 MaxOutstandingReads = 4;
+
+	// Parse chunks are at least this large so small files parse on the calling thread
+	int64 MinParseChunkBytes = 256 * 1024;
+};
+
+class FStreamedTextFile
+{
+public:
+	// Returns null if the file can't be opened or read
+	static TUniquePtr<FStreamedTextFile> Load(const FString& FilePath, const FStreamedTextFileOptions& Options = FStreamedTextFileOptions())
+	{
+		TUniquePtr<FStreamedTextFile> File(new FStreamedTextFile());
+
+		const double ReadStart = FPlatformTime::Seconds();
+		if (!(Options.bAllowMapping && File->Map(FilePath)) && !File->ReadChunked(FilePath, Options))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FStreamedTextFile: failed to read %s"), *FilePath);
+			return nullptr;
+		}
+		File->ReadSeconds = FPlatformTime::Seconds() - ReadStart;
+
+		const double ParseStart = FPlatformTime::Seconds();
+		File->ParseLines(Options);
+		File->ParseSeconds = FPlatformTime::Seconds() - ParseStart;
+
+		return File;
+	}
+
+	// Owns a mapping or a buffer that the line views point into - never copied
+	FStreamedTextFile(const FStreamedTextFile&) = delete;
+	FStreamedTextFile& operator=(const FStreamedTextFile&) = delete;
+
+	~FStreamedTextFile()
+	{
+		// The region must be released before the handle it was mapped from
+		MappedRegion.Reset();
+		MappedHandle.Reset();
+	}
+
+	// One view per line, without the line break. Valid while this object is alive.
+	TConstArrayView<FUtf8StringView> GetLines() const { return Lines; }
+
+	int64 GetSizeBytes() const { return Size; }
+	bool IsMapped() const { return MappedRegion.IsValid(); }
+	double GetReadSeconds() const { return ReadSeconds; }
+	double GetParseSeconds() const { return ParseSeconds; }
+
+private:
+	FStreamedTextFile() = default;
+
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray64<uint8> Buffer;  // Only used when the file isn't mapped
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	TArray<FUtf8StringView> Lines;
+
+	double ReadSeconds = 0.0;
+	double ParseSeconds = 0.0;
+
+	bool Map(const FString& FilePath)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		MappedHandle.Reset(PlatformFile.OpenMapped(*FilePath));
+		if (!MappedHandle || MappedHandle->GetFileSize() <= 0)
+		{
+			// Platforms without mapping return null; an empty file can't be mapped either
+			MappedHandle.Reset();
+			return false;
+		}
+
+		MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+		if (!MappedRegion)
+		{
+			MappedHandle.Reset();
+			return false;
+		}
+
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+		return true;
+	}
+
+	bool ReadChunked(const FString& FilePath, const FStreamedTextFileOptions& Options)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		TUniquePtr<IAsyncReadFileHandle> Handle(PlatformFile.OpenAsyncRead(*FilePath));
+		if (!Handle)
+		{
+			return false;
+		}
+
+		TUniquePtr<IAsyncReadRequest> SizeRequest(Handle->SizeRequest());
+		if (!SizeRequest)
+		{
+			return false;
+		}
+		SizeRequest->WaitCompletion();
+		const int64 FileSize = SizeRequest->GetSizeResults();
+		SizeRequest.Reset();
+
+		if (FileSize < 0)
+		{
+			return false;
+		}
+
+		Buffer.SetNumUninitialized(FileSize);
+
+		// Requests are destroyed before Handle (declared after it) - required by the API
+		TArray<TUniquePtr<IAsyncReadRequest>> InFlight;
+		bool bSucceeded = true;
+
+		auto FinishOldest = [&InFlight, &bSucceeded]()
+		{
+			TUniquePtr<IAsyncReadRequest> Request = MoveTemp(InFlight[0]);
+			InFlight.RemoveAt(0);
+
+			Request->WaitCompletion();
+			bSucceeded &= Request->GetReadResults() != nullptr;  // Returns our own buffer on success
+		};
+
+		const int64 ChunkSize = FMath::Max<int64>(64 * 1024, Options.ReadChunkSize);
+
+		for (int64 Offset = 0; Offset < FileSize && bSucceeded; Offset += ChunkSize)
+		{
+			if (InFlight.Num() >= FMath::Max(1, Options.MaxOutstandingReads))
+			{
+				FinishOldest();
+			}
+
+			const int64 BytesToRead = FMath::Min(ChunkSize, FileSize - Offset);
+			IAsyncReadRequest* Request = Handle->ReadRequest(Offset, BytesToRead, AIOP_Normal, nullptr, Buffer.GetData() + Offset);
+			if (!Request)
+			{
+				bSucceeded = false;
+				break;
+			}
+
+			InFlight.Emplace(Request);
+		}
+
+		while (InFlight.Num() > 0)
+		{
+			FinishOldest();
+		}
+
+		Data = Buffer.GetData();
+		Size = Buffer.Num();
+		return bSucceeded;
+	}
+
+	void ParseLines(const FStreamedTextFileOptions& Options)
+	{
+		int64 Start = 0;
+
+		// Skip a UTF-8 byte order mark
+		if (Size >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+		{
+			Start = 3;
+		}
+
+		// Chunk boundaries are moved forward to just after the next '\n', so every chunk
+		// starts at the beginning of a line and no line is split between two workers
+		const int64 MinChunkBytes = FMath::Max<int64>(1, Options.MinParseChunkBytes);
+		const int32 NumChunks = static_cast<int32>(FMath::Clamp<int64>((Size - Start) / MinChunkBytes, 1,
+			FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 4));
+
+		TArray<int64> Boundaries;
+		Boundaries.Add(Start);
+		for (int32 ChunkIdx = 1; ChunkIdx < NumChunks; ChunkIdx++)
+		{
+			int64 Boundary = FMath::Max(Boundaries.Last(), Start + (Size - Start) * ChunkIdx / NumChunks);
+			while (Boundary < Size && Data[Boundary - 1] != '\n')
+			{
+				Boundary++;
+			}
+			Boundaries.Add(Boundary);
+		}
+		Boundaries.Add(Size);
+
+		TArray<TArray<FUtf8StringView>> ChunkLines;
+		ChunkLines.SetNum(NumChunks);
+
+		FParallelChunkPolicy Policy;
+		Policy.MinChunkSize = 1;  // One parse chunk per claim - they are already large
+
+		ParallelForChunked(NumChunks, [this, &Boundaries, &ChunkLines](int32 StartIdx, int32 EndIdx, int32)
+		{
+			for (int32 ChunkIdx = StartIdx; ChunkIdx < EndIdx; ChunkIdx++)
+			{
+				ParseRange(Boundaries[ChunkIdx], Boundaries[ChunkIdx + 1], ChunkLines[ChunkIdx]);
+			}
+		}, Policy);
+
+		// Only views are appended here - the line bytes themselves are never copied
+		int32 TotalLines = 0;
+		for (const TArray<FUtf8StringView>& Chunk : ChunkLines)
+		{
+			TotalLines += Chunk.Num();
+		}
+
+		Lines.Reserve(TotalLines);
+		for (const TArray<FUtf8StringView>& Chunk : ChunkLines)
+		{
+			Lines.Append(Chunk);
+		}
+	}
+
+	void ParseRange(int64 RangeStart, int64 RangeEnd, TArray<FUtf8StringView>& OutLines) const
+	{
+		int64 LineStart = RangeStart;
+
+		for (int64 i = RangeStart; i < RangeEnd; i++)
+		{
+			if (Data[i] == '\n')
+			{
+				AddLine(LineStart, i, OutLines);
+				LineStart = i + 1;
+			}
+		}
+
+		// Last line of the file without a trailing newline
+		if (LineStart < RangeEnd)
+		{
+			AddLine(LineStart, RangeEnd, OutLines);
+		}
+	}
+
+	void AddLine(int64 LineStart, int64 LineEnd, TArray<FUtf8StringView>& OutLines) const
+	{
+		// Windows line endings
+		if (LineEnd > LineStart && Data[LineEnd - 1] == '\r')
+		{
+			LineEnd--;
+		}
+
+		OutLines.Emplace(reinterpret_cast<const UTF8CHAR*>(Data + LineStart), static_cast<int32>(LineEnd - LineStart));
+	}
+};
+
+// Example usage
+class FStreamingFileLoaderExamples
+{
+public:
+	// Example 1: Load in the background, hand the result to the game thread without copying
+	void LoadAndHandOff(const FString& FilePath)
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Streaming File Loader ==="));
+
+		UE::Tasks::Launch(TEXT("LoadTextFile"), [FilePath]()
+		{
+			TUniquePtr<FStreamedTextFile> File = FStreamedTextFile::Load(FilePath);
+			if (!File)
+			{
+				return;
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("%s: %d lines, %lld bytes, %s, read %.2f ms, parse %.2f ms"),
+				*FilePath, File->GetLines().Num(), File->GetSizeBytes(), File->IsMapped() ? TEXT("mapped") : TEXT("buffered"),
+				File->GetReadSeconds() * 1000.0, File->GetParseSeconds() * 1000.0);
+
+			// AsyncTask takes a TUniqueFunction, so a move-only capture is fine
+			AsyncTask(ENamedThreads::GameThread, [File = MoveTemp(File)]()
+			{
+				if (File->GetLines().Num() > 0)
+				{
+					// Convert only what you keep
+					const FString FirstLine(File->GetLines()[0]);
+					UE_LOG(LogTemp, Log, TEXT("First line: %s"), *FirstLine);
+				}
+			});
+		});
+	}
+
+	// Example 2: WRONG - three copies of the same data
+	void CopyingAntiPattern()
+	{
+		/* DON'T DO THIS:
+		TArray<uint8> FileData;
+		FFileHelper::LoadFileToArray(FileData, *FilePath);        // Copy 1
+
+		TArray<FString> ParsedLines;
+		FString Text;
+		FFileHelper::BufferToString(Text, FileData.GetData(), FileData.Num());
+		Text.ParseIntoArrayLines(ParsedLines);                    // Copy 2 (plus one FString per line)
+
+		AsyncTask(ENamedThreads::GameThread, [ParsedLines]()      // Copy 3
+		{
+		});
+		*/
+
+		// DO THIS:
+		// TUniquePtr<FStreamedTextFile> File = FStreamedTextFile::Load(FilePath);
+		// AsyncTask(ENamedThreads::GameThread, [File = MoveTemp(File)]() { ... });
+	}
+};
@@ -0,0 +1,235 @@
+// Example 10: Game Thread Handoff
+// Move results to the game thread without copies, and batch many small completions
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include <atomic>
+#include <type_traits>
+
+/*
+ * The usual hop copies its payload:
+ *
+ *   AsyncTask(ENamedThreads::GameThread, [WeakThis, Positions]() { ... });
+ *
+ * Capturing Positions by value allocates a new array and copies every element, once
+ * per hop. It also checks WeakThis ad hoc in every callback.
+ *
+ * SendToGameThread fixes both:
+ * - The payload must be an rvalue (MoveTemp) and is moved into the callback, so a TArray
+ *   hop is a pointer swap. For payloads that are expensive to move (large structs),
+ *   pass a TUniquePtr - one heap object, owned by exactly one thread at a time.
+ *   Trivially copyable payloads (counts, handles) copy for free and can be passed as is.
+ * - The target is a TWeakObjectPtr checked ONCE on arrival; the callback receives a
+ *   reference to the live object and is skipped entirely if it was destroyed.
+ *
+ * FGameThreadHandoffQueue goes one step further for many small completions: callbacks
+ * are queued from any thread and run together in one game thread tick per frame,
+ * instead of one task graph dispatch each.
+ */
+
+namespace GameThreadHandoffPrivate
+{
+	template<typename PayloadType>
+	constexpr void CheckPayloadIsRValue()
+	{
+		static_assert(!std::is_lvalue_reference_v<PayloadType> || std::is_trivially_copyable_v<std::remove_reference_t<PayloadType>>,
+			"Pass game thread payloads with MoveTemp - an lvalue would be copied");
+	}
+}
+
+// Moves Payload to the game thread and calls Func(*Target, MoveTemp(Payload)) if Target is still alive
+template<typename ObjectType, typename PayloadType, typename FuncType>
+void SendToGameThread(TWeakObjectPtr<ObjectType> Target, PayloadType&& Payload, FuncType&& Func)
+{
+	GameThreadHandoffPrivate::CheckPayloadIsRValue<PayloadType>();
+
+	AsyncTask(ENamedThreads::GameThread,
+		[Target, Payload = Forward<PayloadType>(Payload), Func = Forward<FuncType>(Func)]() mutable
+		{
+			if (ObjectType* Object = Target.Get())
+			{
+				Func(*Object, MoveTemp(Payload));
+			}
+		});
+}
+
+// Moves Payload to the game thread and calls Func(MoveTemp(Payload)) - for callbacks with no UObject target
+template<typename PayloadType, typename FuncType>
+void SendToGameThread(PayloadType&& Payload, FuncType&& Func)
+{
+	GameThreadHandoffPrivate::CheckPayloadIsRValue<PayloadType>();
+
+	AsyncTask(ENamedThreads::GameThread,
+		[Payload = Forward<PayloadType>(Payload), Func = Forward<FuncType>(Func)]() mutable
+		{
+			Func(MoveTemp(Payload));
+		});
+}
+
+/*
+ * Multi-producer queue of game thread callbacks, drained once per frame by a core ticker.
+ *
+ * Use it when hundreds of tasks each finish with a small result: one ticker callback
+ * per frame runs all of them, instead of hundreds of task graph dispatches.
+ * Results arrive on the next frame at the latest - use SendToGameThread when a
+ * callback must run as soon as possible.
+ */
+class FGameThreadHandoffQueue
+{
+public:
+	struct FStats
+	{
+		int64 NumCallbacks = 0;
+		int64 NumFlushes = 0;   // Frames that ran at least one callback
+		int32 MaxBatch = 0;     // Most callbacks run in a single frame
+	};
+
+	// Created on first use, never destroyed - tasks may still enqueue during shutdown
+	static FGameThreadHandoffQueue& Get()
+	{
+		static FGameThreadHandoffQueue* Instance = new FGameThreadHandoffQueue();
+		return *Instance;
+	}
+
+	// Any thread
+	void Enqueue(TUniqueFunction<void()> Callback)
+	{
+		Pending.Enqueue(MoveTemp(Callback));
+	}
+
+	// Any thread. Payload is moved; Func(*Target, MoveTemp(Payload)) runs only if Target is alive.
+	template<typename ObjectType, typename PayloadType, typename FuncType>
+	void Enqueue(TWeakObjectPtr<ObjectType> Target, PayloadType&& Payload, FuncType&& Func)
+	{
+		GameThreadHandoffPrivate::CheckPayloadIsRValue<PayloadType>();
+
+		Enqueue([Target, Payload = Forward<PayloadType>(Payload), Func = Forward<FuncType>(Func)]() mutable
+		{
+			if (ObjectType* Object = Target.Get())
+			{
+				Func(*Object, MoveTemp(Payload));
+			}
+		});
+	}
+
+	// Game thread only. Runs everything queued so far. Called by the ticker every frame.
+	void Flush()
+	{
+		check(IsInGameThread());
+
+		int32 NumRun = 0;
+		TUniqueFunction<void()> Callback;
+		while (Pending.Dequeue(Callback))
+		{
+			Callback();
+			NumRun++;
+		}
+
+		if (NumRun > 0)
+		{
+			NumCallbacks += NumRun;
+			NumFlushes++;
+			MaxBatch = FMath::Max(MaxBatch, NumRun);
+		}
+	}
+
+	FStats GetStats() const
+	{
+		FStats Stats;
+		Stats.NumCallbacks = NumCallbacks;
+		Stats.NumFlushes = NumFlushes;
+		Stats.MaxBatch = MaxBatch;
+		return Stats;
+	}
+
+private:
+	FGameThreadHandoffQueue()
+	{
+		// FTSTicker is thread-safe to register with, and always ticks on the game thread
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+		{
+			Flush();
+			return true;  // Keep ticking
+		}));
+	}
+
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> Pending;
+
+	// Only touched by Flush on the game thread
+	int64 NumCallbacks = 0;
+	int64 NumFlushes = 0;
+	int32 MaxBatch = 0;
+};
+
+// Example usage
+class FGameThreadHandoffExamples
+{
+public:
+	// Example 1: Move the result to the game thread instead of copying it
+	void MoveInsteadOfCopy()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Game Thread Handoff: Move ==="));
+
+		UE::Tasks::Launch(TEXT("ComputePositions"), []()
+		{
+			TArray<FVector> Positions;
+			Positions.SetNumUninitialized(100000);
+			for (int32 i = 0; i < Positions.Num(); i++)
+			{
+				Positions[i] = FVector(i, 0.0f, 0.0f);
+			}
+
+			// The array buffer changes owner - no allocation, no element copies
+			SendToGameThread(MoveTemp(Positions), [](TArray<FVector>&& Arrived)
+			{
+				UE_LOG(LogTemp, Log, TEXT("Game thread received %d positions"), Arrived.Num());
+			});
+		});
+	}
+
+	// Example 2: Many small completions, one game thread callback per frame
+	void CoalescedCompletions()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Game Thread Handoff: Coalesced ==="));
+
+		for (int32 TaskIdx = 0; TaskIdx < 500; TaskIdx++)
+		{
+			UE::Tasks::Launch(TEXT("SmallJob"), [TaskIdx]()
+			{
+				const float Value = FMath::Sin(static_cast<float>(TaskIdx));
+
+				// Queued, not dispatched - the whole batch runs in the next frame's tick
+				FGameThreadHandoffQueue::Get().Enqueue([TaskIdx, Value]()
+				{
+					UE_LOG(LogTemp, Verbose, TEXT("Job %d finished: %f"), TaskIdx, Value);
+				});
+			});
+		}
+	}
+
+	// Example 3: WRONG - copying into the callback
+	void CopyIntoCallbackAntiPattern()
+	{
+		/* DON'T DO THIS:
+		TArray<FVector> Results = Compute();
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Results]()  // Copies every element
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->Apply(Results);                            // IsValid + Get: two lookups
+			}
+		});
+		*/
+
+		// DO THIS:
+		// SendToGameThread(WeakThis, MoveTemp(Results), [](AMyActor& Actor, TArray<FVector>&& Arrived) { ... });
+
+		// Note: SendToGameThread(WeakThis, Results, ...) doesn't compile - the static_assert
+		// catches the accidental copy
+	}
+};
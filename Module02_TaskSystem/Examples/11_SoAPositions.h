@@ -0,0 +1,248 @@
+// Example 11: Structure-of-Arrays Positions
+// Separate aligned X/Y/Z streams for batch generation and vectorized distance passes
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+/*
+ * TArray<FVector> is an array of structures (AoS): X Y Z X Y Z X Y Z ...
+ * A distance pass over it loads 24 bytes per point (FVector is 3 doubles in UE5),
+ * and the loop can't use SIMD lanes without shuffling components around.
+ *
+ * FPositionStreams stores the same data as a structure of arrays (SoA):
+ *   X: X X X X ...
+ *   Y: Y Y Y Y ...
+ *   Z: Z Z Z Z ...
+ *
+ * - Each stream is 16-byte aligned and presized, so generators write element i in
+ *   place (no Add, no growth) and vector loops use aligned 4-wide loads.
+ * - A length pass reads 12 bytes per point instead of 24, and processes 4 points per
+ *   instruction - for 100k+ points the pass is memory bound, so halving the bytes matters.
+ * - AsAoS() gives a read-only FVector view for code that still wants AoS, and
+ *   ToAoS()/FromAoS() convert at API boundaries.
+ *
+ * NOTE: The streams are float. For world positions far from the origin, store
+ * positions relative to a local origin to keep precision.
+ */
+class FPositionStreams
+{
+public:
+	using FStream = TArray<float, TAlignedHeapAllocator<16>>;
+
+	FStream X;
+	FStream Y;
+	FStream Z;
+
+	FPositionStreams() = default;
+
+	explicit FPositionStreams(int32 NumPoints)
+	{
+		SetNumUninitialized(NumPoints);
+	}
+
+	// Presize all three streams - contents are undefined until written
+	void SetNumUninitialized(int32 NumPoints)
+	{
+		X.SetNumUninitialized(NumPoints);
+		Y.SetNumUninitialized(NumPoints);
+		Z.SetNumUninitialized(NumPoints);
+	}
+
+	int32 Num() const { return X.Num(); }
+
+	FVector GetPosition(int32 Index) const
+	{
+		return FVector(X[Index], Y[Index], Z[Index]);
+	}
+
+	void SetPosition(int32 Index, const FVector& Position)
+	{
+		X[Index] = static_cast<float>(Position.X);
+		Y[Index] = static_cast<float>(Position.Y);
+		Z[Index] = static_cast<float>(Position.Z);
+	}
+
+	// OutLengths[i] = |Position[i]|, 4 points per iteration with a scalar tail
+	void ComputeLengths(TArrayView<float> OutLengths) const
+	{
+		check(OutLengths.Num() == Num());
+
+		const int32 NumPoints = Num();
+		int32 i = 0;
+
+		for (; i + 4 <= NumPoints; i += 4)
+		{
+			// Streams are 16-byte aligned and i is a multiple of 4
+			const VectorRegister4Float VX = VectorLoadAligned(X.GetData() + i);
+			const VectorRegister4Float VY = VectorLoadAligned(Y.GetData() + i);
+			const VectorRegister4Float VZ = VectorLoadAligned(Z.GetData() + i);
+
+			const VectorRegister4Float SquaredLength = VectorMultiplyAdd(VX, VX, VectorMultiplyAdd(VY, VY, VectorMultiply(VZ, VZ)));
+			VectorStore(VectorSqrt(SquaredLength), OutLengths.GetData() + i);  // Output may not be aligned
+		}
+
+		for (; i < NumPoints; i++)
+		{
+			OutLengths[i] = FMath::Sqrt(X[i] * X[i] + Y[i] * Y[i] + Z[i] * Z[i]);
+		}
+	}
+
+	TArray<float> ComputeLengths() const
+	{
+		TArray<float> Lengths;
+		Lengths.SetNumUninitialized(Num());
+		ComputeLengths(Lengths);
+		return Lengths;
+	}
+
+	// Average distance to Center without storing per-point lengths
+	float ComputeAverageDistance(const FVector& Center = FVector::ZeroVector) const
+	{
+		const int32 NumPoints = Num();
+		if (NumPoints == 0)
+		{
+			return 0.0f;
+		}
+
+		const VectorRegister4Float CX = VectorSetFloat1(static_cast<float>(Center.X));
+		const VectorRegister4Float CY = VectorSetFloat1(static_cast<float>(Center.Y));
+		const VectorRegister4Float CZ = VectorSetFloat1(static_cast<float>(Center.Z));
+
+		VectorRegister4Float Sum = VectorZeroFloat();
+		int32 i = 0;
+
+		for (; i + 4 <= NumPoints; i += 4)
+		{
+			const VectorRegister4Float DX = VectorSubtract(VectorLoadAligned(X.GetData() + i), CX);
+			const VectorRegister4Float DY = VectorSubtract(VectorLoadAligned(Y.GetData() + i), CY);
+			const VectorRegister4Float DZ = VectorSubtract(VectorLoadAligned(Z.GetData() + i), CZ);
+
+			Sum = VectorAdd(Sum, VectorSqrt(VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)))));
+		}
+
+		// Horizontal sum of the 4 lanes, then the tail - accumulate in double
+		alignas(16) float Lanes[4];
+		VectorStoreAligned(Sum, Lanes);
+		double Total = static_cast<double>(Lanes[0]) + Lanes[1] + Lanes[2] + Lanes[3];
+
+		for (; i < NumPoints; i++)
+		{
+			Total += FVector(X[i] - Center.X, Y[i] - Center.Y, Z[i] - Center.Z).Size();
+		}
+
+		return static_cast<float>(Total / NumPoints);
+	}
+
+	// Read-only AoS view - builds each FVector on access, nothing is copied up front
+	class FAoSView
+	{
+	public:
+		explicit FAoSView(const FPositionStreams& InStreams) : Streams(InStreams) {}
+
+		int32 Num() const { return Streams.Num(); }
+		FVector operator[](int32 Index) const { return Streams.GetPosition(Index); }
+
+		struct FIterator
+		{
+			const FPositionStreams& Streams;
+			int32 Index;
+
+			FVector operator*() const { return Streams.GetPosition(Index); }
+			FIterator& operator++() { ++Index; return *this; }
+			bool operator!=(const FIterator& Other) const { return Index != Other.Index; }
+		};
+
+		FIterator begin() const { return FIterator{Streams, 0}; }
+		FIterator end() const { return FIterator{Streams, Streams.Num()}; }
+
+	private:
+		const FPositionStreams& Streams;
+	};
+
+	FAoSView AsAoS() const { return FAoSView(*this); }
+
+	// Converts at API boundaries that need a real TArray<FVector>
+	TArray<FVector> ToAoS() const
+	{
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(Num());
+		for (int32 i = 0; i < Num(); i++)
+		{
+			Positions[i] = GetPosition(i);
+		}
+		return Positions;
+	}
+
+	static FPositionStreams FromAoS(TConstArrayView<FVector> Positions)
+	{
+		FPositionStreams Streams(Positions.Num());
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			Streams.SetPosition(i, Positions[i]);
+		}
+		return Streams;
+	}
+};
+
+// Example usage
+class FSoAPositionsExamples
+{
+public:
+	// Example 1: Fill in place, then a vectorized distance pass
+	void GenerateAndMeasure()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== SoA Positions: Generate and Measure ==="));
+
+		const int32 NumPoints = 200000;
+		FPositionStreams Positions(NumPoints);  // Presized once
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			// Written in place - no Add(), no reallocation
+			Positions.X[i] = static_cast<float>(i % 100);
+			Positions.Y[i] = static_cast<float>((i / 100) % 100);
+			Positions.Z[i] = 0.0f;
+		}
+
+		const float Average = Positions.ComputeAverageDistance();
+		UE_LOG(LogTemp, Log, TEXT("%d points, average distance %.2f"), NumPoints, Average);
+	}
+
+	// Example 2: Interop with code that wants FVector
+	void AoSInterop()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== SoA Positions: AoS Interop ==="));
+
+		FPositionStreams Positions = FPositionStreams::FromAoS({FVector(1, 0, 0), FVector(0, 2, 0), FVector(0, 0, 3)});
+
+		// Range-for over the view yields FVector by value
+		for (const FVector& Position : Positions.AsAoS())
+		{
+			UE_LOG(LogTemp, Log, TEXT("Position: %s"), *Position.ToString());
+		}
+	}
+
+	// Example 3: WRONG - AoS growth in the hot loop
+	void AoSGrowthAntiPattern()
+	{
+		/* DON'T DO THIS:
+		TArray<FVector> Positions;
+		for (int32 i = 0; i < 100000; i++)
+		{
+			Positions.Add(Start + Offset(i));   // Grows and reallocates as it goes
+		}
+
+		for (const FVector& Pos : Positions)
+		{
+			Distances.Add(Pos.Size());          // 24 bytes loaded per point, one point at a time
+		}
+		*/
+
+		// DO THIS:
+		// FPositionStreams Positions(Num);     // Presized, aligned
+		// ... write Positions.X[i], Y[i], Z[i] ...
+		// TArray<float> Distances = Positions.ComputeLengths();
+	}
+};
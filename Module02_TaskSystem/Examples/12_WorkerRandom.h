@@ -0,0 +1,283 @@
+// Example 12: Per-Worker Random Numbers
+// Seeded PCG streams per thread or per task - no shared state, reproducible results
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+#include "11_SoAPositions.h"
+#include <atomic>
+
+/*
+ * FMath::RandRange / FMath::FRand use one global generator. Calling them from task threads:
+ * - Contends: every call from every worker reads and writes the same state
+ * - Isn't reproducible: the sequence each task sees depends on how the scheduler
+ *   interleaved the other tasks, so a replay with the same seed gives different results
+ *
+ * FPcgRandomStream is a small PCG32 generator (16 bytes of state) with the same method
+ * names as FRandomStream, so it drops into existing code. FWorkerRandom hands them out:
+ *
+ *   FWorkerRandom::ForThread()     - one stream per thread, created on first use.
+ *                                    Fastest, no contention, but which items a thread
+ *                                    processes depends on scheduling - NOT reproducible.
+ *   FWorkerRandom::ForTask(Key)    - a fresh stream derived from (global seed, Key).
+ *                                    Same key + same seed = same numbers, on any thread,
+ *                                    in any order. Use the work item / chunk index as Key.
+ *
+ * Batch fills (FillUniform, FillVectors, FillPositions) generate a whole buffer in one
+ * tight loop instead of one call per component.
+ */
+class FPcgRandomStream
+{
+public:
+	FPcgRandomStream()
+	{
+		Initialize(0, 0);
+	}
+
+	explicit FPcgRandomStream(uint64 Seed, uint64 Sequence = 0)
+	{
+		Initialize(Seed, Sequence);
+	}
+
+	// Different Sequence values give independent streams for the same Seed
+	void Initialize(uint64 Seed, uint64 Sequence = 0)
+	{
+		State = 0;
+		Increment = (Sequence << 1) | 1;  // Must be odd
+		GetUnsignedInt();
+		State += Seed;
+		GetUnsignedInt();
+	}
+
+	// Uniform in [0, 2^32)
+	FORCEINLINE uint32 GetUnsignedInt()
+	{
+		const uint64 OldState = State;
+		State = OldState * 6364136223846793005ULL + Increment;
+
+		const uint32 XorShifted = static_cast<uint32>(((OldState >> 18) ^ OldState) >> 27);
+		const uint32 Rotation = static_cast<uint32>(OldState >> 59);
+		return (XorShifted >> Rotation) | (XorShifted << ((0u - Rotation) & 31));
+	}
+
+	// Uniform in [0, 1) - 24 random bits, exactly representable as float
+	FORCEINLINE float GetFraction()
+	{
+		return (GetUnsignedInt() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	FORCEINLINE float FRand()
+	{
+		return GetFraction();
+	}
+
+	// Uniform in [Min, Max)
+	FORCEINLINE float FRandRange(float Min, float Max)
+	{
+		return Min + (Max - Min) * GetFraction();
+	}
+
+	// Uniform in [Min, Max] (inclusive, like FMath::RandRange)
+	FORCEINLINE int32 RandRange(int32 Min, int32 Max)
+	{
+		const uint64 Range = static_cast<uint64>(static_cast<int64>(Max) - Min + 1);
+		return Min + static_cast<int32>((static_cast<uint64>(GetUnsignedInt()) * Range) >> 32);
+	}
+
+	// Uniform in [0, Max)
+	FORCEINLINE int32 RandHelper(int32 Max)
+	{
+		return Max > 0 ? RandRange(0, Max - 1) : 0;
+	}
+
+	// Random unit vector
+	FVector VRand()
+	{
+		FVector Result;
+		double LengthSquared;
+
+		// Rejection sampling inside the unit sphere, then normalize
+		do
+		{
+			Result = FVector(FRandRange(-1.0f, 1.0f), FRandRange(-1.0f, 1.0f), FRandRange(-1.0f, 1.0f));
+			LengthSquared = Result.SizeSquared();
+		}
+		while (LengthSquared > 1.0 || LengthSquared < UE_KINDA_SMALL_NUMBER);
+
+		return Result * (1.0 / FMath::Sqrt(LengthSquared));
+	}
+
+	// Out[i] uniform in [Min, Max)
+	void FillUniform(TArrayView<float> Out, float Min, float Max)
+	{
+		const float Scale = (Max - Min) * (1.0f / 16777216.0f);
+		for (float& Value : Out)
+		{
+			Value = Min + (GetUnsignedInt() >> 8) * Scale;
+		}
+	}
+
+	// Out[i] uniform in the box Center +- Extent
+	void FillVectors(TArrayView<FVector> Out, const FVector& Center, const FVector& Extent)
+	{
+		for (FVector& Value : Out)
+		{
+			Value = Center + FVector(FRandRange(-1.0f, 1.0f), FRandRange(-1.0f, 1.0f), FRandRange(-1.0f, 1.0f)) * Extent;
+		}
+	}
+
+	// Fills presized SoA streams with points in the box Center +- Extent, one stream at a time
+	void FillPositions(FPositionStreams& Out, const FVector& Center, const FVector& Extent)
+	{
+		FillUniform(Out.X, static_cast<float>(Center.X - Extent.X), static_cast<float>(Center.X + Extent.X));
+		FillUniform(Out.Y, static_cast<float>(Center.Y - Extent.Y), static_cast<float>(Center.Y + Extent.Y));
+		FillUniform(Out.Z, static_cast<float>(Center.Z - Extent.Z), static_cast<float>(Center.Z + Extent.Z));
+	}
+
+private:
+	uint64 State;
+	uint64 Increment;
+};
+
+class FWorkerRandom
+{
+public:
+	// Changing the seed reseeds every thread stream on its next use
+	static void SetGlobalSeed(uint64 Seed)
+	{
+		GlobalSeed().store(Seed);
+		SeedGeneration()++;
+	}
+
+	static uint64 GetGlobalSeed()
+	{
+		return GlobalSeed().load();
+	}
+
+	// This thread's stream. No locks, no sharing - but not reproducible across runs.
+	static FPcgRandomStream& ForThread()
+	{
+		struct FThreadStream
+		{
+			FPcgRandomStream Stream;
+			uint32 Generation = MAX_uint32;
+			uint32 ThreadOrdinal = NextThreadOrdinal()++;
+		};
+
+		static thread_local FThreadStream ThreadStream;
+
+		const uint32 Generation = SeedGeneration().load(std::memory_order_relaxed);
+		if (ThreadStream.Generation != Generation)
+		{
+			// Each thread gets its own PCG sequence, so streams never overlap
+			ThreadStream.Stream.Initialize(GetGlobalSeed(), ThreadStream.ThreadOrdinal);
+			ThreadStream.Generation = Generation;
+		}
+
+		return ThreadStream.Stream;
+	}
+
+	// A stream that depends only on the global seed and Key - reproducible on any thread
+	static FPcgRandomStream ForTask(uint64 Key)
+	{
+		return FPcgRandomStream(Mix(GetGlobalSeed() ^ Mix(Key)), Key);
+	}
+
+private:
+	static std::atomic<uint64>& GlobalSeed()
+	{
+		static std::atomic<uint64> Seed{0x853C49E6748FEA9BULL};
+		return Seed;
+	}
+
+	static std::atomic<uint32>& SeedGeneration()
+	{
+		static std::atomic<uint32> Generation{0};
+		return Generation;
+	}
+
+	static std::atomic<uint32>& NextThreadOrdinal()
+	{
+		static std::atomic<uint32> Ordinal{0};
+		return Ordinal;
+	}
+
+	// SplitMix64 finalizer - spreads nearby keys (0, 1, 2...) across the whole seed space
+	static uint64 Mix(uint64 Value)
+	{
+		Value += 0x9E3779B97F4A7C15ULL;
+		Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBULL;
+		return Value ^ (Value >> 31);
+	}
+};
+
+// Example usage
+class FWorkerRandomExamples
+{
+public:
+	// Example 1: Reproducible parallel generation - one stream per chunk, keyed by chunk index
+	void ReproducibleGeneration()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Worker Random: Reproducible ==="));
+
+		FWorkerRandom::SetGlobalSeed(42);
+
+		const int32 NumChunks = 8;
+		const int32 PointsPerChunk = 10000;
+
+		TArray<FVector> Points;
+		Points.SetNumUninitialized(NumChunks * PointsPerChunk);
+
+		TArray<UE::Tasks::FTask> Tasks;
+		for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ChunkIdx++)
+		{
+			Tasks.Add(UE::Tasks::Launch(TEXT("GenerateChunk"), [&Points, ChunkIdx, PointsPerChunk]()
+			{
+				// Same seed + same chunk index = same points, whichever worker runs this
+				FPcgRandomStream Random = FWorkerRandom::ForTask(ChunkIdx);
+				Random.FillVectors(TArrayView<FVector>(Points).Slice(ChunkIdx * PointsPerChunk, PointsPerChunk),
+					FVector::ZeroVector, FVector(100.0f));
+			}));
+		}
+
+		UE::Tasks::Wait(Tasks);
+		UE_LOG(LogTemp, Log, TEXT("First point with seed 42: %s (same on every run)"), *Points[0].ToString());
+	}
+
+	// Example 2: Throwaway randomness - thread stream, no contention
+	void FastThreadLocal()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Worker Random: Thread Streams ==="));
+
+		UE::Tasks::Launch(TEXT("Jitter"), []()
+		{
+			FPcgRandomStream& Random = FWorkerRandom::ForThread();
+
+			float Total = 0.0f;
+			for (int32 i = 0; i < 100000; i++)
+			{
+				Total += Random.FRandRange(-1.0f, 1.0f);
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("Average jitter: %f"), Total / 100000.0f);
+		}).Wait();
+	}
+
+	// Example 3: WRONG - global RNG from many tasks
+	void GlobalRandAntiPattern()
+	{
+		/* DON'T DO THIS:
+		ParallelFor(NumPoints, [&](int32 i)
+		{
+			// Every worker hits the same global state, and the sequence depends on scheduling
+			Points[i] = FVector(FMath::RandRange(-100.0f, 100.0f), FMath::RandRange(-100.0f, 100.0f), 0.0f);
+		});
+		*/
+
+		// DO THIS:
+		// FPcgRandomStream Random = FWorkerRandom::ForTask(ChunkIdx);
+		// Random.FillVectors(ChunkPoints, Center, Extent);
+	}
+};
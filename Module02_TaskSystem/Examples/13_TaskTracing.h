@@ -0,0 +1,425 @@
+// Example 13: Task Graph Tracing
+// Record launch/start/end times and prerequisite edges, export Chrome trace JSON, find the critical path
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/Reverse.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Tasks/Task.h"
+
+/*
+ * The TEXT("...") name given to UE::Tasks::Launch shows up in Insights only as a generic
+ * task scope, and nothing records which task waited on which. When a DAG finishes late,
+ * the question is "which stage held it up?" - and that needs the edges.
+ *
+ * FTaskTraceSession::Launch() is UE::Tasks::Launch with tracing:
+ *
+ *   FTaskTraceSession Trace(TEXT("Diamond"));
+ *   auto Top    = Trace.Launch(TEXT("Top"), [] { return 100; });
+ *   auto Left   = Trace.Launch(TEXT("Left"), [Top] { return Top.GetResult() + 10; }, Top);
+ *   auto Bottom = Trace.Launch(TEXT("Bottom"), [...] { ... }, Left, Right);
+ *
+ * Prerequisites are passed as trailing arguments (traced tasks), or as an array through
+ * LaunchAfter(), so the session sees every edge. Per task it records:
+ * - Launch, start and end timestamps, and the worker thread that ran it
+ * - Its prerequisites
+ * And it emits:
+ * - A CPU profiler scope named after the task (Insights Timing view, "cpu" channel),
+ *   plus a bookmark when a session starts
+ * - ExportChromeTrace(): JSON for chrome://tracing / Perfetto, with flow arrows for edges
+ *
+ * Analyze() waits for all tasks, then computes:
+ * - The critical path: from the last task to finish, repeatedly step to the prerequisite
+ *   that finished last - the chain that actually determined the end time
+ * - Per task, PrereqWait (launch -> last prerequisite done) and QueueWait (ready ->
+ *   picked up by a worker). Large QueueWait = not enough workers, not a slow stage.
+ *
+ * Cost: one small allocation and a lock per Launch, two timestamps per task. Fine for
+ * dozens to thousands of tasks - don't trace every ParallelFor item.
+ *
+ * The session must outlive its tasks; the destructor waits for them.
+ */
+
+struct FTaskTraceEvent
+{
+	FString Name;
+	int32 Id = INDEX_NONE;
+	TArray<int32> Prerequisites;
+
+	uint64 LaunchCycles = 0;
+	uint64 StartCycles = 0;
+	uint64 EndCycles = 0;
+	uint32 ThreadId = 0;
+};
+
+// A launched task plus its id in the session - use it like the TTask it wraps
+template<typename ResultType>
+struct TTracedTask
+{
+	UE::Tasks::TTask<ResultType> Task;
+	int32 TraceId = INDEX_NONE;
+
+	decltype(auto) GetResult() const
+	{
+		return Task.GetResult();
+	}
+
+	void Wait() const
+	{
+		Task.Wait();
+	}
+
+	bool IsCompleted() const
+	{
+		return Task.IsCompleted();
+	}
+};
+
+struct FTaskTraceTiming
+{
+	FString Name;
+	uint32 ThreadId = 0;
+	double StartMs = 0.0;        // Relative to the first task start in the session
+	double DurationMs = 0.0;
+	double PrereqWaitMs = 0.0;   // Launched, waiting on prerequisites
+	double QueueWaitMs = 0.0;    // Ready, waiting for a worker
+	bool bOnCriticalPath = false;
+};
+
+struct FTaskTraceReport
+{
+	TArray<FTaskTraceTiming> Tasks;  // Indexed by trace id
+	TArray<int32> CriticalPath;      // Trace ids, first to last
+	double TotalMs = 0.0;            // First start -> last end
+	double CriticalPathBusyMs = 0.0; // Sum of durations along the critical path
+
+	void Log(const TCHAR* SessionName) const
+	{
+		UE_LOG(LogTemp, Log, TEXT("Task trace '%s': %d tasks, %.2f ms total, critical path %.2f ms busy"),
+			SessionName, Tasks.Num(), TotalMs, CriticalPathBusyMs);
+
+		for (int32 Id : CriticalPath)
+		{
+			const FTaskTraceTiming& Timing = Tasks[Id];
+			UE_LOG(LogTemp, Log, TEXT("  * %-20s start %7.2f  run %7.2f  prereq wait %7.2f  queue wait %7.2f  (thread %u)"),
+				*Timing.Name, Timing.StartMs, Timing.DurationMs, Timing.PrereqWaitMs, Timing.QueueWaitMs, Timing.ThreadId);
+		}
+	}
+};
+
+class FTaskTraceSession
+{
+public:
+	explicit FTaskTraceSession(const FString& InSessionName)
+		: SessionName(InSessionName)
+	{
+		TRACE_BOOKMARK(TEXT("TaskTrace: %s"), *SessionName);
+	}
+
+	~FTaskTraceSession()
+	{
+		WaitAll();
+	}
+
+	FTaskTraceSession(const FTaskTraceSession&) = delete;
+	FTaskTraceSession& operator=(const FTaskTraceSession&) = delete;
+
+	// UE::Tasks::Launch, recorded. Trailing arguments are prerequisites (TTracedTask).
+	template<typename TaskBodyType, typename... PrereqTypes>
+	auto Launch(const TCHAR* Name, TaskBodyType&& TaskBody, const PrereqTypes&... Prereqs)
+	{
+		return LaunchInternal(Name, Forward<TaskBodyType>(TaskBody), {Prereqs.TraceId...}, {Prereqs.Task...});
+	}
+
+	// Same, with a prerequisite count only known at runtime (fan-in)
+	template<typename TaskBodyType, typename PrereqResultType>
+	auto LaunchAfter(const TCHAR* Name, TaskBodyType&& TaskBody, const TArray<TTracedTask<PrereqResultType>>& Prereqs)
+	{
+		TArray<int32> PrereqIds;
+		TArray<UE::Tasks::FTask> PrereqTasks;
+		for (const TTracedTask<PrereqResultType>& Prereq : Prereqs)
+		{
+			PrereqIds.Add(Prereq.TraceId);
+			PrereqTasks.Add(Prereq.Task);
+		}
+		return LaunchInternal(Name, Forward<TaskBodyType>(TaskBody), MoveTemp(PrereqIds), MoveTemp(PrereqTasks));
+	}
+
+	void WaitAll()
+	{
+		TArray<UE::Tasks::FTask> TasksToWait;
+		{
+			FScopeLock Lock(&EventsLock);
+			TasksToWait = Tasks;
+		}
+		UE::Tasks::Wait(TasksToWait);
+	}
+
+	// Waits for every task launched so far, then computes timings and the critical path
+	FTaskTraceReport Analyze()
+	{
+		WaitAll();
+
+		FScopeLock Lock(&EventsLock);
+		FTaskTraceReport Report;
+		if (Events.Num() == 0)
+		{
+			return Report;
+		}
+
+		const uint64 Origin = GetOriginCycles();
+		auto ToMs = [](uint64 Cycles) { return FPlatformTime::ToMilliseconds64(Cycles); };
+
+		Report.Tasks.SetNum(Events.Num());
+		int32 LastToFinish = 0;
+		for (int32 Id = 0; Id < Events.Num(); Id++)
+		{
+			const FTaskTraceEvent& Event = *Events[Id];
+
+			// Ready = launched and every prerequisite done
+			uint64 ReadyCycles = Event.LaunchCycles;
+			for (int32 PrereqId : Event.Prerequisites)
+			{
+				ReadyCycles = FMath::Max(ReadyCycles, Events[PrereqId]->EndCycles);
+			}
+
+			FTaskTraceTiming& Timing = Report.Tasks[Id];
+			Timing.Name = Event.Name;
+			Timing.ThreadId = Event.ThreadId;
+			Timing.StartMs = ToMs(Event.StartCycles - Origin);
+			Timing.DurationMs = ToMs(Event.EndCycles - Event.StartCycles);
+			Timing.PrereqWaitMs = ToMs(ReadyCycles - Event.LaunchCycles);
+			Timing.QueueWaitMs = ToMs(Event.StartCycles > ReadyCycles ? Event.StartCycles - ReadyCycles : 0);
+
+			if (Event.EndCycles > Events[LastToFinish]->EndCycles)
+			{
+				LastToFinish = Id;
+			}
+		}
+
+		// Walk back from the last task along the prerequisite that released it
+		for (int32 Id = LastToFinish; Id != INDEX_NONE;)
+		{
+			Report.CriticalPath.Add(Id);
+			Report.Tasks[Id].bOnCriticalPath = true;
+			Report.CriticalPathBusyMs += Report.Tasks[Id].DurationMs;
+
+			int32 Gating = INDEX_NONE;
+			for (int32 PrereqId : Events[Id]->Prerequisites)
+			{
+				if (Gating == INDEX_NONE || Events[PrereqId]->EndCycles > Events[Gating]->EndCycles)
+				{
+					Gating = PrereqId;
+				}
+			}
+			Id = Gating;
+		}
+		Algo::Reverse(Report.CriticalPath);
+
+		Report.TotalMs = ToMs(Events[LastToFinish]->EndCycles - Origin);
+		return Report;
+	}
+
+	// chrome://tracing or ui.perfetto.dev - one row per worker thread, arrows for prerequisite edges
+	bool ExportChromeTrace(const FString& FilePath)
+	{
+		const FTaskTraceReport Report = Analyze();
+
+		FScopeLock Lock(&EventsLock);
+		const uint64 Origin = GetOriginCycles();
+		auto ToUs = [Origin](uint64 Cycles) { return FPlatformTime::ToMilliseconds64(Cycles - Origin) * 1000.0; };
+
+		FString Json;
+		Json.Reserve(Events.Num() * 256);
+		Json += TEXT("{\"traceEvents\":[\n");
+
+		int32 FlowId = 0;
+		for (int32 Id = 0; Id < Events.Num(); Id++)
+		{
+			const FTaskTraceEvent& Event = *Events[Id];
+			const FTaskTraceTiming& Timing = Report.Tasks[Id];
+
+			Json += FString::Printf(
+				TEXT("%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,")
+				TEXT("\"args\":{\"prereq_wait_ms\":%.3f,\"queue_wait_ms\":%.3f,\"critical\":%s}}"),
+				Id > 0 ? TEXT(",\n") : TEXT(""),
+				*Event.Name.ReplaceCharWithEscapedChar(), *SessionName.ReplaceCharWithEscapedChar(),
+				Event.ThreadId, ToUs(Event.StartCycles), ToUs(Event.EndCycles) - ToUs(Event.StartCycles),
+				Timing.PrereqWaitMs, Timing.QueueWaitMs, Timing.bOnCriticalPath ? TEXT("true") : TEXT("false"));
+
+			// Flow arrow: leaves the end of the prerequisite, arrives at the start of this task
+			for (int32 PrereqId : Event.Prerequisites)
+			{
+				const FTaskTraceEvent& Prereq = *Events[PrereqId];
+				Json += FString::Printf(
+					TEXT(",\n{\"name\":\"dep\",\"cat\":\"dep\",\"ph\":\"s\",\"id\":%d,\"pid\":1,\"tid\":%u,\"ts\":%.3f}")
+					TEXT(",\n{\"name\":\"dep\",\"cat\":\"dep\",\"ph\":\"f\",\"bp\":\"e\",\"id\":%d,\"pid\":1,\"tid\":%u,\"ts\":%.3f}"),
+					FlowId, Prereq.ThreadId, ToUs(Prereq.EndCycles) - 0.001,
+					FlowId, Event.ThreadId, ToUs(Event.StartCycles));
+				FlowId++;
+			}
+		}
+
+		Json += TEXT("\n]}\n");
+		return FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	const FString& GetName() const { return SessionName; }
+
+private:
+	template<typename TaskBodyType>
+	auto LaunchInternal(const TCHAR* Name, TaskBodyType&& TaskBody, TArray<int32> PrereqIds, TArray<UE::Tasks::FTask> PrereqTasks)
+	{
+		using ResultType = decltype(TaskBody());
+
+		FTaskTraceEvent* Event = AddEvent(Name, MoveTemp(PrereqIds));
+
+		auto TracedBody = [Event, Body = Forward<TaskBodyType>(TaskBody)]() mutable
+		{
+			// Each task writes only its own event; Analyze() reads after waiting on the task
+			Event->StartCycles = FPlatformTime::Cycles64();
+			Event->ThreadId = FPlatformTLS::GetCurrentThreadId();
+			ON_SCOPE_EXIT
+			{
+				Event->EndCycles = FPlatformTime::Cycles64();
+			};
+
+			TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Event->Name);
+			return Body();
+		};
+
+		TTracedTask<ResultType> Traced;
+		Traced.TraceId = Event->Id;
+		Traced.Task = UE::Tasks::Launch(Name, MoveTemp(TracedBody), UE::Tasks::Prerequisites(PrereqTasks));
+
+		FScopeLock Lock(&EventsLock);
+		Tasks.Add(Traced.Task);
+		return Traced;
+	}
+
+	// Earliest task start. Not Events[0]: ids are handed out under the lock, a task can start before
+	// a lower id does. Caller holds EventsLock and has waited for the tasks.
+	uint64 GetOriginCycles() const
+	{
+		uint64 Origin = MAX_uint64;
+		for (const TUniquePtr<FTaskTraceEvent>& Event : Events)
+		{
+			Origin = FMath::Min(Origin, Event->StartCycles);
+		}
+		return Events.Num() > 0 ? Origin : 0;
+	}
+
+	FTaskTraceEvent* AddEvent(const TCHAR* Name, TArray<int32> Prerequisites)
+	{
+		TUniquePtr<FTaskTraceEvent> Event = MakeUnique<FTaskTraceEvent>();
+		Event->Name = Name;
+		Event->Prerequisites = MoveTemp(Prerequisites);
+		Event->LaunchCycles = FPlatformTime::Cycles64();
+
+		// Events are heap allocated so the pointer captured by the task stays valid as the array grows
+		FScopeLock Lock(&EventsLock);
+		Event->Id = Events.Num();
+		return Events.Add_GetRef(MoveTemp(Event)).Get();
+	}
+
+	FString SessionName;
+
+	FCriticalSection EventsLock;
+	TArray<TUniquePtr<FTaskTraceEvent>> Events;
+	TArray<UE::Tasks::FTask> Tasks;
+};
+
+// Example usage
+class FTaskTracingExamples
+{
+public:
+	// Example 1: Diamond from 02_TaskDependencies.h with a slow Right branch
+	void TracedDiamond()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Traced Diamond ==="));
+
+		FTaskTraceSession Trace(TEXT("DiamondSlowRight"));
+
+		auto Top = Trace.Launch(TEXT("Top"), []() -> int32
+		{
+			FPlatformProcess::Sleep(0.01f);
+			return 100;
+		});
+
+		auto Left = Trace.Launch(TEXT("Left"), [Top]() -> int32
+		{
+			FPlatformProcess::Sleep(0.02f);
+			return Top.GetResult() + 10;
+		}, Top);
+
+		auto Right = Trace.Launch(TEXT("Right"), [Top]() -> int32
+		{
+			FPlatformProcess::Sleep(0.08f);
+			return Top.GetResult() + 20;
+		}, Top);
+
+		auto Bottom = Trace.Launch(TEXT("Bottom"), [Left, Right]() -> int32
+		{
+			return Left.GetResult() + Right.GetResult();
+		}, Left, Right);
+
+		UE_LOG(LogTemp, Log, TEXT("Diamond result: %d"), Bottom.GetResult());
+
+		// Critical path: Top -> Right -> Bottom. Left is off the path - speeding it up changes nothing.
+		Trace.Analyze().Log(*Trace.GetName());
+		Trace.ExportChromeTrace(FPaths::ProfilingDir() / TEXT("DiamondSlowRight.json"));
+	}
+
+	// Example 2: Fan-in with more sources than workers - QueueWait shows the shortage
+	void TracedFanIn()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Traced Fan-In ==="));
+
+		FTaskTraceSession Trace(TEXT("FanIn"));
+
+		TArray<TTracedTask<int32>> Sources;
+		for (int32 i = 0; i < 64; i++)
+		{
+			Sources.Add(Trace.Launch(TEXT("Source"), [i]() -> int32
+			{
+				FPlatformProcess::Sleep(0.005f);
+				return i;
+			}));
+		}
+
+		// Runtime-sized prerequisite list - still one edge per source
+		auto Combine = Trace.LaunchAfter(TEXT("Combine"), [Sources]() -> int32
+		{
+			int32 Total = 0;
+			for (const TTracedTask<int32>& Source : Sources)
+			{
+				Total += Source.GetResult();
+			}
+			return Total;
+		}, Sources);
+
+		UE_LOG(LogTemp, Log, TEXT("Fan-in total: %d"), Combine.GetResult());
+		Trace.Analyze().Log(*Trace.GetName());
+	}
+
+	// Example 3: WRONG - launching untraced prerequisites inside a traced graph
+	void UntracedPrerequisiteAntiPattern()
+	{
+		/* DON'T DO THIS:
+		UE::Tasks::FTask Load = UE::Tasks::Launch(TEXT("Load"), [] { ... });
+		auto Parse = Trace.Launch(TEXT("Parse"), [] { ... });  // Waits on Load inside the body
+		// The trace has no edge Load -> Parse, so Parse looks slow and Load never appears
+		*/
+
+		// DO THIS:
+		// auto Load = Trace.Launch(TEXT("Load"), [] { ... });
+		// auto Parse = Trace.Launch(TEXT("Parse"), [Load] { ... }, Load);
+	}
+};
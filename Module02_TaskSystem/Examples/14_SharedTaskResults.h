@@ -0,0 +1,184 @@
+// Example 14: Shared Task Results
+// Hand a task's result to many readers without copying it, or move it to its only reader
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+
+/*
+ * TTask<TArray<int32>>::GetResult() returns a reference to the array stored in the task.
+ * The usual pattern copies it:
+ *
+ *   TArray<int32> Data = SourceTask.GetResult();   // Deep copy - per consumer
+ *
+ * A fan-out with three workers copies the source three times; a chain of stages copies at
+ * every hop. With multi-megabyte intermediates the copies cost more than the work.
+ *
+ * Two replacements, depending on how many tasks read the result:
+ *
+ * MANY readers - LaunchShared():
+ *   The body returns T as usual; the task's result becomes TSharedResult<T>
+ *   (TSharedRef<const T>). One buffer, read-only, shared by every consumer.
+ *   ReadResult(Task) returns const T&, ViewResult(Task) a TConstArrayView for arrays.
+ *   A consumer can also keep the TSharedResult after the task handle is gone.
+ *
+ * ONE reader - TakeResult():
+ *   Moves the value out of the task. No copy, no allocation - the consumer can even edit
+ *   the buffer in place and return it. After the move the task's result is empty, so
+ *   this is only correct when nothing else reads that task.
+ *
+ * Both are plain UE::Tasks - Prerequisites etc. are unchanged.
+ */
+
+// Immutable result shared between consumer tasks
+template<typename T>
+using TSharedResult = TSharedRef<const T, ESPMode::ThreadSafe>;
+
+// UE::Tasks::Launch whose result is wrapped once in a TSharedResult.
+// Trailing arguments (Prerequisites, priority) are passed through to Launch.
+template<typename TaskBodyType, typename... LaunchArgTypes>
+auto LaunchShared(const TCHAR* DebugName, TaskBodyType&& TaskBody, LaunchArgTypes&&... LaunchArgs)
+{
+	using ResultType = typename TDecay<decltype(TaskBody())>::Type;
+
+	return UE::Tasks::Launch(
+		DebugName,
+		[Body = Forward<TaskBodyType>(TaskBody)]() mutable -> TSharedResult<ResultType>
+		{
+			return MakeShared<ResultType, ESPMode::ThreadSafe>(Body());
+		},
+		Forward<LaunchArgTypes>(LaunchArgs)...);
+}
+
+// Read-only access to a shared result - valid as long as the task (or a copy of it) is alive
+template<typename T>
+const T& ReadResult(const UE::Tasks::TTask<TSharedResult<T>>& Task)
+{
+	return *Task.GetResult();
+}
+
+template<typename ElementType>
+TConstArrayView<ElementType> ViewResult(const UE::Tasks::TTask<TSharedResult<TArray<ElementType>>>& Task)
+{
+	return *Task.GetResult();
+}
+
+// Moves the result out of its task. Single consumer only - the task is left holding an empty value.
+template<typename T>
+T TakeResult(UE::Tasks::TTask<T>& Task)
+{
+	return MoveTemp(Task.GetResult());
+}
+
+// Example usage
+class FSharedTaskResultExamples
+{
+public:
+	// Example 1: Fan-out over one multi-megabyte buffer
+	void SharedFanOut()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Shared Fan-Out ==="));
+
+		auto Samples = LaunchShared(TEXT("GenerateSamples"), []()
+		{
+			TArray<float> Data;
+			Data.SetNumUninitialized(4 * 1024 * 1024);  // 16 MB
+			for (int32 i = 0; i < Data.Num(); i++)
+			{
+				Data[i] = FMath::Sin(i * 0.001f);
+			}
+			return Data;
+		});
+
+		// Each worker reads the same buffer - zero copies instead of three
+		auto Mean = UE::Tasks::Launch(TEXT("Mean"), [Samples]()
+		{
+			double Sum = 0.0;
+			for (float Value : ViewResult(Samples))
+			{
+				Sum += Value;
+			}
+			return Sum / ViewResult(Samples).Num();
+		}, UE::Tasks::Prerequisites(Samples));
+
+		auto Peak = UE::Tasks::Launch(TEXT("Peak"), [Samples]()
+		{
+			float Max = 0.0f;
+			for (float Value : ViewResult(Samples))
+			{
+				Max = FMath::Max(Max, FMath::Abs(Value));
+			}
+			return Max;
+		}, UE::Tasks::Prerequisites(Samples));
+
+		auto Crossings = UE::Tasks::Launch(TEXT("ZeroCrossings"), [Samples]()
+		{
+			TConstArrayView<float> Data = ViewResult(Samples);
+			int32 Count = 0;
+			for (int32 i = 1; i < Data.Num(); i++)
+			{
+				Count += (Data[i - 1] < 0.0f) != (Data[i] < 0.0f);
+			}
+			return Count;
+		}, UE::Tasks::Prerequisites(Samples));
+
+		UE_LOG(LogTemp, Log, TEXT("Mean %.4f, peak %.4f, %d zero crossings"),
+			Mean.GetResult(), Peak.GetResult(), Crossings.GetResult());
+
+		// Read after the consumers finished. They captured the task handle and only viewed the
+		// buffer, so the one reference left is the task's own result.
+		UE_LOG(LogTemp, Log, TEXT("Buffer read by 3 consumers, references held now (task result included): %d"),
+			Samples.GetResult().GetSharedReferenceCount());
+	}
+
+	// Example 2: Single consumer chain - each stage takes the previous buffer and edits it in place
+	void MoveOutChain()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Move-Out Chain ==="));
+
+		auto Load = UE::Tasks::Launch(TEXT("Load"), []()
+		{
+			TArray<int32> Data;
+			Data.SetNumUninitialized(1024 * 1024);
+			for (int32 i = 0; i < Data.Num(); i++)
+			{
+				Data[i] = i;
+			}
+			return Data;
+		});
+
+		// mutable - TakeResult modifies the captured task handle's result
+		auto Scale = UE::Tasks::Launch(TEXT("Scale"), [Load]() mutable
+		{
+			TArray<int32> Data = TakeResult(Load);  // Moved - same allocation as Load's array
+			for (int32& Value : Data)
+			{
+				Value *= 2;
+			}
+			return Data;
+		}, UE::Tasks::Prerequisites(Load));
+
+		auto Count = UE::Tasks::Launch(TEXT("Count"), [Scale]() mutable
+		{
+			return TakeResult(Scale).Num();
+		}, UE::Tasks::Prerequisites(Scale));
+
+		UE_LOG(LogTemp, Log, TEXT("Chain processed %d values with one allocation"), Count.GetResult());
+	}
+
+	// Example 3: WRONG - moving out of a result that has several readers
+	void TakeSharedResultAntiPattern()
+	{
+		/* DON'T DO THIS:
+		auto Source = UE::Tasks::Launch(TEXT("Source"), [] { return BuildBigArray(); });
+		auto A = UE::Tasks::Launch(TEXT("A"), [Source]() mutable { Use(TakeResult(Source)); }, Prerequisites(Source));
+		auto B = UE::Tasks::Launch(TEXT("B"), [Source]() { Use(Source.GetResult()); }, Prerequisites(Source));
+		// B may see an empty array - or a half-moved one, since A and B run concurrently
+		*/
+
+		// DO THIS:
+		// auto Source = LaunchShared(TEXT("Source"), [] { return BuildBigArray(); });
+		// Both A and B read ViewResult(Source)
+	}
+};
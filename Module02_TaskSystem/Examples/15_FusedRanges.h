@@ -0,0 +1,236 @@
+// Example 15: Fused Range Pipelines
+// Filter().Map().Reduce() stages fused into one pass per chunk, chunks run in parallel
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "07_ParallelChunking.h"
+#include <type_traits>
+
+/*
+ * A stage-per-task pipeline (see PipelineWithFiltering in 02_TaskDependencies.h) writes a
+ * whole TArray between every pair of stages:
+ *
+ *   Generate -> TArray -> Filter -> TArray -> Square -> TArray -> Sum
+ *
+ * Three extra passes over memory and three allocations, and each stage waits for the
+ * previous one to finish completely before it starts.
+ *
+ * TFusedRange keeps the stage syntax but builds ONE loop:
+ *
+ *   int64 Sum = MakeFusedIota(1, 20)
+ *       .Filter([](int32 N) { return N % 2 == 0; })
+ *       .Map([](int32 N) { return static_cast<int64>(N) * N; })
+ *       .Sum();
+ *
+ * - Filter/Map are lazy: they wrap the previous stage's per-chunk loop in another lambda,
+ *   nothing runs and nothing is allocated until a terminal operation is called
+ * - Terminals (Reduce, Sum, Count, ForEach) split the source index range with
+ *   ParallelReduce / ParallelForChunked (see 07_ParallelChunking.h), and each chunk runs
+ *   every stage back to back for one element before moving on to the next
+ * - The only memory touched is the source and one accumulator per worker
+ *
+ * Stage functions run on several workers at once, so they must be thread-safe
+ * (pure functions of their argument). Reduce operators must be associative.
+ *
+ * Sources:
+ *   MakeFusedRange(View)              - elements of a TConstArrayView / TArray
+ *   MakeFusedIota(First, Num)         - First, First + 1, ... First + Num - 1
+ *   MakeFusedGenerate(Num, Func)      - Func(Index) for each index
+ */
+
+// LoopType(StartIdx, EndIdx, Sink) calls Sink(Value) for every element that survives the
+// stages, for source indices [StartIdx, EndIdx)
+template<typename ElementType, typename LoopType>
+class TFusedRange
+{
+public:
+	TFusedRange(int32 InNum, LoopType InLoop)
+		: Num(InNum)
+		, Loop(MoveTemp(InLoop))
+	{
+	}
+
+	// Keeps elements where Predicate(Element) is true
+	template<typename PredicateType>
+	auto Filter(PredicateType Predicate) const
+	{
+		auto FilteredLoop = [Inner = Loop, Predicate](int32 StartIdx, int32 EndIdx, auto&& Sink)
+		{
+			Inner(StartIdx, EndIdx, [&Predicate, &Sink](auto&& Value)
+			{
+				if (Predicate(Value))
+				{
+					Sink(Forward<decltype(Value)>(Value));
+				}
+			});
+		};
+		return TFusedRange<ElementType, decltype(FilteredLoop)>(Num, MoveTemp(FilteredLoop));
+	}
+
+	// Replaces each element with Func(Element)
+	template<typename FuncType>
+	auto Map(FuncType Func) const
+	{
+		using OutType = std::decay_t<std::invoke_result_t<FuncType&, const ElementType&>>;
+
+		auto MappedLoop = [Inner = Loop, Func](int32 StartIdx, int32 EndIdx, auto&& Sink)
+		{
+			Inner(StartIdx, EndIdx, [&Func, &Sink](auto&& Value)
+			{
+				Sink(Func(Forward<decltype(Value)>(Value)));
+			});
+		};
+		return TFusedRange<OutType, decltype(MappedLoop)>(Num, MoveTemp(MappedLoop));
+	}
+
+	// Folds elements with Op(Acc, Element) per worker, then combines partials with CombineOp(Acc, Acc)
+	template<typename AccType, typename OpType, typename CombineOpType>
+	AccType Reduce(const AccType& Identity, OpType Op, CombineOpType CombineOp, const FParallelChunkPolicy& Policy = FParallelChunkPolicy()) const
+	{
+		return ParallelReduce(Num, Identity,
+			[this, &Op](int32 StartIdx, int32 EndIdx, AccType& Acc)
+			{
+				Loop(StartIdx, EndIdx, [&Acc, &Op](auto&& Value)
+				{
+					Acc = Op(MoveTemp(Acc), Forward<decltype(Value)>(Value));
+				});
+			},
+			CombineOp, Policy);
+	}
+
+	// Same operator for folding and combining (sum, min, max, ...)
+	template<typename AccType, typename OpType>
+	AccType Reduce(const AccType& Identity, OpType Op, const FParallelChunkPolicy& Policy = FParallelChunkPolicy()) const
+	{
+		return Reduce(Identity, Op, Op, Policy);
+	}
+
+	ElementType Sum(const FParallelChunkPolicy& Policy = FParallelChunkPolicy()) const
+	{
+		return Reduce(ElementType(0), [](const ElementType& A, const ElementType& B) { return A + B; }, Policy);
+	}
+
+	int32 Count(const FParallelChunkPolicy& Policy = FParallelChunkPolicy()) const
+	{
+		return Reduce(0, [](int32 Acc, const ElementType&) { return Acc + 1; }, [](int32 A, int32 B) { return A + B; }, Policy);
+	}
+
+	// Calls Func(Element) in parallel - no ordering between chunks
+	template<typename FuncType>
+	void ForEach(FuncType Func, const FParallelChunkPolicy& Policy = FParallelChunkPolicy()) const
+	{
+		ParallelForChunked(Num, [this, &Func](int32 StartIdx, int32 EndIdx, int32)
+		{
+			Loop(StartIdx, EndIdx, Func);
+		}, Policy);
+	}
+
+	// Number of SOURCE elements (before filtering)
+	int32 SourceNum() const { return Num; }
+
+private:
+	int32 Num;
+	LoopType Loop;
+};
+
+template<typename ElementType>
+auto MakeFusedRange(TConstArrayView<ElementType> Source)
+{
+	auto Loop = [Source](int32 StartIdx, int32 EndIdx, auto&& Sink)
+	{
+		for (int32 i = StartIdx; i < EndIdx; i++)
+		{
+			Sink(Source[i]);
+		}
+	};
+	return TFusedRange<ElementType, decltype(Loop)>(Source.Num(), MoveTemp(Loop));
+}
+
+template<typename ElementType>
+auto MakeFusedRange(const TArray<ElementType>& Source)
+{
+	return MakeFusedRange(TConstArrayView<ElementType>(Source));
+}
+
+inline auto MakeFusedIota(int32 First, int32 Num)
+{
+	auto Loop = [First](int32 StartIdx, int32 EndIdx, auto&& Sink)
+	{
+		for (int32 i = StartIdx; i < EndIdx; i++)
+		{
+			Sink(First + i);
+		}
+	};
+	return TFusedRange<int32, decltype(Loop)>(Num, MoveTemp(Loop));
+}
+
+template<typename FuncType>
+auto MakeFusedGenerate(int32 Num, FuncType Func)
+{
+	using ElementType = std::decay_t<std::invoke_result_t<FuncType&, int32>>;
+
+	auto Loop = [Func](int32 StartIdx, int32 EndIdx, auto&& Sink)
+	{
+		for (int32 i = StartIdx; i < EndIdx; i++)
+		{
+			Sink(Func(i));
+		}
+	};
+	return TFusedRange<ElementType, decltype(Loop)>(Num, MoveTemp(Loop));
+}
+
+// Example usage
+class FFusedRangeExamples
+{
+public:
+	// Example 1: Filter -> square -> sum over 1M values, one pass, no intermediate arrays.
+	// The result is ~1.67e17 - at 10M values it would be ~1.67e20 and overflow int64.
+	void FilterSquareSum()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Fused Range: Filter -> Square -> Sum ==="));
+
+		const int64 Sum = MakeFusedIota(1, 1000 * 1000)
+			.Filter([](int32 Num) { return Num % 2 == 0; })
+			.Map([](int32 Num) { return static_cast<int64>(Num) * Num; })
+			.Sum();
+
+		UE_LOG(LogTemp, Log, TEXT("Sum of squared evens: %lld"), Sum);
+	}
+
+	// Example 2: Existing data - the stages read the array in place
+	void OverExistingArray()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Fused Range: Existing Array ==="));
+
+		TArray<float> Distances;
+		for (int32 i = 0; i < 100000; i++)
+		{
+			Distances.Add(static_cast<float>(i % 5000));
+		}
+
+		const int32 NumInRange = MakeFusedRange(Distances)
+			.Filter([](float Distance) { return Distance < 1500.0f; })
+			.Count();
+
+		const float Farthest = MakeFusedRange(Distances)
+			.Reduce(0.0f, [](float A, float B) { return FMath::Max(A, B); });
+
+		UE_LOG(LogTemp, Log, TEXT("%d in range, farthest %.1f"), NumInRange, Farthest);
+	}
+
+	// Example 3: WRONG - stateful stage functions
+	void StatefulStageAntiPattern()
+	{
+		/* DON'T DO THIS:
+		int32 Seen = 0;
+		auto Range = MakeFusedIota(0, 1000000).Filter([&Seen](int32) { return ++Seen % 2 == 0; });
+		// Chunks run on several workers at once - Seen is a data race, and the result
+		// depends on which worker saw which element
+		*/
+
+		// DO THIS:
+		// Decide from the element alone: .Filter([](int32 N) { return N % 2 == 0; })
+		// and count with a terminal: .Count()
+	}
+};
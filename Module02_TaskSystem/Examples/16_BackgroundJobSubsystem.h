@@ -0,0 +1,349 @@
+// Example 16: Background Job Subsystem
+// World subsystem that limits jobs in flight and runs completions under a per-frame time budget
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Queue.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include <atomic>
+#include <type_traits>
+#include "16_BackgroundJobSubsystem.generated.h"
+
+/*
+ * Every actor launching its own tasks and hopping back with AsyncTask works - until
+ * hundreds of actors do it in the same frame:
+ * - Nothing limits how much background work is queued at once
+ * - Every completion runs on the game thread as soon as it arrives, so a frame where
+ *   many jobs finish together is a hitch
+ *
+ * UBackgroundJobSubsystem is the one place actors submit jobs to:
+ *
+ *   UBackgroundJobSubsystem* Jobs = GetWorld()->GetSubsystem<UBackgroundJobSubsystem>();
+ *   Jobs->Submit(this, EBackgroundJobPriority::Normal,
+ *       [Input]() { return Compute(Input); },                           // Worker thread
+ *       [](AMyActor& Actor, FResult&& Result) { Actor.Apply(Result); }); // Game thread
+ *
+ * - At most MaxJobsInFlight jobs run at once; the rest wait in per-priority queues and
+ *   are launched High -> Normal -> Low as slots free up
+ * - Finished jobs queue their completion. Tick() runs completions High -> Normal -> Low
+ *   until CompletionBudgetMs is used up; the rest are deferred to the next frame (at
+ *   least one completion runs per frame, so nothing starves)
+ * - Completions are delivered in one batch per frame, and SubmitBatch() runs N
+ *   work items and hands all N results to a single completion
+ * - The owner is held weakly: if it's destroyed before its completion runs, the
+ *   completion is skipped. Results are moved, never copied.
+ *
+ * Work functions run on worker threads - no UObject access there (see 03_GameThreadInteraction.h).
+ */
+
+enum class EBackgroundJobPriority : uint8
+{
+	High,    // Gameplay-visible results - launched and completed first
+	Normal,
+	Low,     // Cosmetic or speculative work - first to be deferred
+
+	Count
+};
+
+struct FBackgroundJobStats
+{
+	int64 NumSubmitted = 0;
+	int64 NumCompleted = 0;
+	int32 NumPending = 0;            // Submitted, not launched yet (over MaxJobsInFlight)
+	int32 NumInFlight = 0;           // Running on workers
+	int32 NumQueuedCompletions = 0;  // Finished, waiting for the game thread
+	int32 LastFrameCompletions = 0;
+	float LastFrameMs = 0.0f;        // Game thread time spent in completions last frame
+	int64 NumDeferredFrames = 0;     // Frames that hit the budget with completions left over
+};
+
+UCLASS()
+class UBackgroundJobSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Game thread time per frame for completions
+	UPROPERTY()
+	float CompletionBudgetMs = 2.0f;
+
+	// Jobs running on workers at once, across all actors in this world
+	UPROPERTY()
+	int32 MaxJobsInFlight = 32;
+
+	/*
+	 * Runs Work() on a worker, then OnComplete(*Owner, MoveTemp(Result)) on the game thread
+	 * within the frame budget - skipped if Owner is gone. Work may return void, in which case
+	 * OnComplete(*Owner) is called. Game thread only.
+	 */
+	template<typename ObjectType, typename WorkType, typename CompleteType>
+	void Submit(ObjectType* Owner, EBackgroundJobPriority Priority, WorkType&& Work, CompleteType&& OnComplete)
+	{
+		check(IsInGameThread());
+
+		using ResultType = std::decay_t<decltype(Work())>;
+
+		const int32 PriorityIndex = static_cast<int32>(Priority);
+		const TWeakObjectPtr<ObjectType> WeakOwner(Owner);
+
+		Pending[PriorityIndex].Enqueue([Shared = Shared, PriorityIndex, Priority, WeakOwner,
+			Work = Forward<WorkType>(Work), OnComplete = Forward<CompleteType>(OnComplete)]() mutable
+		{
+			// Game thread, a slot is free - start the work
+			UE::Tasks::Launch(TEXT("BackgroundJob"), [Shared, PriorityIndex, WeakOwner,
+				Work = MoveTemp(Work), OnComplete = MoveTemp(OnComplete)]() mutable
+			{
+				if constexpr (std::is_void_v<ResultType>)
+				{
+					Work();
+					Shared->PushCompletion(PriorityIndex, [WeakOwner, OnComplete = MoveTemp(OnComplete)]() mutable
+					{
+						if (ObjectType* Object = WeakOwner.Get())
+						{
+							OnComplete(*Object);
+						}
+					});
+				}
+				else
+				{
+					ResultType Result = Work();
+					Shared->PushCompletion(PriorityIndex, [WeakOwner, Result = MoveTemp(Result), OnComplete = MoveTemp(OnComplete)]() mutable
+					{
+						if (ObjectType* Object = WeakOwner.Get())
+						{
+							OnComplete(*Object, MoveTemp(Result));
+						}
+					});
+				}
+			}, ToTaskPriority(Priority));
+		});
+
+		NumPending++;
+		Stats.NumSubmitted++;
+
+		// Start right away if there's a free slot
+		LaunchPending();
+	}
+
+	/*
+	 * NumItems work items as ONE job: Work(Index) runs in parallel for every index, and
+	 * OnComplete(*Owner, TArray<ResultType>&&) receives all results at once, in index order.
+	 * Counts as a single job against MaxJobsInFlight.
+	 */
+	template<typename ObjectType, typename WorkType, typename CompleteType>
+	void SubmitBatch(ObjectType* Owner, EBackgroundJobPriority Priority, int32 NumItems, WorkType&& Work, CompleteType&& OnComplete)
+	{
+		using ItemType = std::decay_t<decltype(Work(0))>;
+
+		Submit(Owner, Priority,
+			[NumItems, Work = Forward<WorkType>(Work)]()
+			{
+				TArray<ItemType> Results;
+				Results.SetNum(NumItems);
+				ParallelFor(NumItems, [&Results, &Work](int32 Index)
+				{
+					Results[Index] = Work(Index);
+				});
+				return Results;
+			},
+			Forward<CompleteType>(OnComplete));
+	}
+
+	FBackgroundJobStats GetStats() const
+	{
+		FBackgroundJobStats Result = Stats;
+		Result.NumPending = NumPending;
+		Result.NumInFlight = Shared->NumInFlight.load(std::memory_order_relaxed);
+		Result.NumQueuedCompletions = Shared->NumQueuedCompletions.load(std::memory_order_relaxed);
+		return Result;
+	}
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override
+	{
+		// Jobs still running finish into the shared queues, which are simply never drained again
+		Shared->bClosed.store(true);
+		for (TQueue<TUniqueFunction<void()>>& Queue : Pending)
+		{
+			Queue.Empty();
+		}
+		NumPending = 0;
+
+		Super::Deinitialize();
+	}
+
+	virtual void Tick(float DeltaTime) override
+	{
+		LaunchPending();
+		RunCompletions();
+
+		// Finished jobs freed their slots - refill them now rather than next frame
+		LaunchPending();
+	}
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UBackgroundJobSubsystem, STATGROUP_Tickables);
+	}
+
+private:
+	static constexpr int32 NumPriorities = static_cast<int32>(EBackgroundJobPriority::Count);
+
+	// Outlives the subsystem while jobs are running - workers only ever touch this
+	struct FSharedState
+	{
+		TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> Completions[NumPriorities];
+		std::atomic<int32> NumInFlight{0};
+		std::atomic<int32> NumQueuedCompletions{0};
+		std::atomic<bool> bClosed{false};
+
+		// Worker thread: the job's work is done, its slot is free
+		void PushCompletion(int32 PriorityIndex, TUniqueFunction<void()> Completion)
+		{
+			if (!bClosed.load())
+			{
+				NumQueuedCompletions.fetch_add(1, std::memory_order_relaxed);
+				Completions[PriorityIndex].Enqueue(MoveTemp(Completion));
+			}
+			NumInFlight.fetch_sub(1, std::memory_order_release);
+		}
+	};
+
+	static UE::Tasks::ETaskPriority ToTaskPriority(EBackgroundJobPriority Priority)
+	{
+		switch (Priority)
+		{
+		case EBackgroundJobPriority::High:
+			return UE::Tasks::ETaskPriority::High;
+		case EBackgroundJobPriority::Low:
+			return UE::Tasks::ETaskPriority::BackgroundNormal;
+		default:
+			return UE::Tasks::ETaskPriority::Normal;
+		}
+	}
+
+	// Game thread: launches queued jobs, highest priority first, while slots are free
+	void LaunchPending()
+	{
+		for (int32 PriorityIndex = 0; PriorityIndex < NumPriorities; PriorityIndex++)
+		{
+			TUniqueFunction<void()> Launch;
+			while (Shared->NumInFlight.load(std::memory_order_acquire) < MaxJobsInFlight
+				&& Pending[PriorityIndex].Dequeue(Launch))
+			{
+				Shared->NumInFlight.fetch_add(1, std::memory_order_relaxed);
+				NumPending--;
+				Launch();
+			}
+		}
+	}
+
+	// Game thread: runs completions until the budget is spent
+	void RunCompletions()
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const uint64 BudgetCycles = static_cast<uint64>(FMath::Max(0.0, CompletionBudgetMs / 1000.0) / FPlatformTime::GetSecondsPerCycle64());
+
+		int32 NumRun = 0;
+		bool bOverBudget = false;
+		for (int32 PriorityIndex = 0; PriorityIndex < NumPriorities && !bOverBudget; PriorityIndex++)
+		{
+			TUniqueFunction<void()> Completion;
+			while (Shared->Completions[PriorityIndex].Dequeue(Completion))
+			{
+				Shared->NumQueuedCompletions.fetch_sub(1, std::memory_order_relaxed);
+				Completion();
+				NumRun++;
+
+				// Checked after running, so at least one completion runs every frame
+				if (FPlatformTime::Cycles64() - StartCycles >= BudgetCycles)
+				{
+					bOverBudget = true;
+					break;
+				}
+			}
+		}
+
+		Stats.NumCompleted += NumRun;
+		Stats.LastFrameCompletions = NumRun;
+		Stats.LastFrameMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+
+		if (bOverBudget && Shared->NumQueuedCompletions.load(std::memory_order_relaxed) > 0)
+		{
+			Stats.NumDeferredFrames++;
+		}
+	}
+
+	TSharedRef<FSharedState, ESPMode::ThreadSafe> Shared = MakeShared<FSharedState, ESPMode::ThreadSafe>();
+
+	// Game thread only
+	TQueue<TUniqueFunction<void()>> Pending[NumPriorities];
+	int32 NumPending = 0;
+	FBackgroundJobStats Stats;
+};
+
+// Example usage
+class FBackgroundJobSubsystemExamples
+{
+public:
+	// Example 1: Hundreds of actors submitting in the same frame
+	void ManyActorsSameFrame(UWorld* World, const TArray<AActor*>& Actors)
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Background Jobs: Many Actors ==="));
+
+		UBackgroundJobSubsystem* Jobs = World->GetSubsystem<UBackgroundJobSubsystem>();
+		for (AActor* Actor : Actors)
+		{
+			const FVector Origin = Actor->GetActorLocation();  // Read on the game thread
+
+			// 32 run at once; the rest start as slots free up. Completions spread over frames.
+			Jobs->Submit(Actor, EBackgroundJobPriority::Low,
+				[Origin]()
+				{
+					TArray<FVector> Points;
+					for (int32 i = 0; i < 1000; i++)
+					{
+						Points.Add(Origin + FVector(i, 0.0f, 0.0f));
+					}
+					return Points;
+				},
+				[](AActor& Owner, TArray<FVector>&& Points)
+				{
+					// Game thread, within the frame budget
+					UE_LOG(LogTemp, Verbose, TEXT("%s received %d points"), *Owner.GetName(), Points.Num());
+				});
+		}
+	}
+
+	// Example 2: One job, many items, one completion
+	void BatchedResults(UWorld* World, AActor* Owner)
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Background Jobs: Batch ==="));
+
+		World->GetSubsystem<UBackgroundJobSubsystem>()->SubmitBatch(Owner, EBackgroundJobPriority::Normal, 64,
+			[](int32 Index) { return Index * Index; },
+			[](AActor& Actor, TArray<int32>&& Squares)
+			{
+				UE_LOG(LogTemp, Log, TEXT("%s: %d results in one completion"), *Actor.GetName(), Squares.Num());
+			});
+	}
+
+	// Example 3: WRONG - bypassing the subsystem for bulk work
+	void UnbudgetedAntiPattern()
+	{
+		/* DON'T DO THIS (from every actor, every frame):
+		UE::Tasks::Launch(TEXT("Work"), [WeakThis]()
+		{
+			FResult Result = Compute();
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Result]() { ... });  // Runs as soon as it lands
+		});
+		// 500 actors finishing together = 500 game thread callbacks in one frame
+		*/
+
+		// DO THIS:
+		// Jobs->Submit(this, Priority, [..]() { return Compute(); }, [](AMyActor& A, FResult&& R) { ... });
+	}
+};
@@ -0,0 +1,297 @@
+// Example 17: Task Cancellation
+// Cooperative cancellation tokens tied to an owner's lifetime and optional deadlines
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+#include "07_ParallelChunking.h"
+#include <atomic>
+
+/*
+ * Checking WeakThis.IsValid() at the END of a background job protects the UObject, but the
+ * job still runs to completion. When a level streams out and 300 actors go away, their
+ * jobs keep the workers busy producing results that are thrown away.
+ *
+ * FCancellationToken lets the work find out early:
+ *
+ *   FCancellationToken Token = FCancellationToken::ForOwner(this, 2.0);  // Owner lifetime + 2 s deadline
+ *   UE::Tasks::Launch(TEXT("Work"), [Token]()
+ *   {
+ *       for (...chunk...)
+ *       {
+ *           if (Token.IsCancelled()) return;   // Between chunks - cheap
+ *           ...
+ *       }
+ *   });
+ *
+ * A token is cancelled when any of these happens (the first reason is latched):
+ * - Cancel() is called on it (or any copy - copies share state)
+ * - Its owner UObject is garbage collected. The check is the thread-safe weak pointer test,
+ *   which only sees GC - between Destroy()/EndPlay and the next GC the owner still counts as
+ *   alive. To stop work at EndPlay, cancel a token (or FCancellationSource) from EndPlay.
+ * - Its deadline passes
+ * - Its parent is cancelled (MakeChild: a tighter deadline for one request under an
+ *   actor-wide token)
+ *
+ * Helpers:
+ * - LaunchCancellable(): doesn't launch at all if the token is already cancelled, and skips
+ *   the body if it was cancelled while waiting for its prerequisites
+ * - ParallelForCancellable(): guided chunks (see 07_ParallelChunking.h); once cancelled,
+ *   the remaining chunks are skipped
+ * - FCancellationSource: owns a token and cancels it when destroyed or Reset() - a member
+ *   for "cancel the previous request when a new one starts"
+ *
+ * Cancellation is cooperative: a stage that never checks runs to the end. Check between
+ * chunks of work, not per element.
+ */
+
+enum class ECancelReason : uint8
+{
+	None,
+	Cancelled,      // Cancel() called
+	OwnerDestroyed,
+	DeadlinePassed,
+	ParentCancelled
+};
+
+class FCancellationToken
+{
+public:
+	// Never cancelled unless Cancel() is called (or a deadline is given)
+	static FCancellationToken Create(double TimeoutSeconds = 0.0)
+	{
+		return FCancellationToken(nullptr, TimeoutSeconds, nullptr);
+	}
+
+	// Cancelled once Owner is garbage collected, or after TimeoutSeconds if > 0
+	static FCancellationToken ForOwner(const UObject* Owner, double TimeoutSeconds = 0.0)
+	{
+		return FCancellationToken(Owner, TimeoutSeconds, nullptr);
+	}
+
+	// Cancelled with this token, or earlier - by its own Cancel() or TimeoutSeconds
+	FCancellationToken MakeChild(double TimeoutSeconds = 0.0) const
+	{
+		return FCancellationToken(nullptr, TimeoutSeconds, State);
+	}
+
+	// Any thread
+	void Cancel() const
+	{
+		Latch(ECancelReason::Cancelled);
+	}
+
+	// Any thread. Cheap when nothing has been cancelled: an atomic load, a weak pointer
+	// serial number check and a clock read if there's a deadline.
+	bool IsCancelled() const
+	{
+		return GetReason() != ECancelReason::None;
+	}
+
+	ECancelReason GetReason() const
+	{
+		ECancelReason Reason = State->Reason.load(std::memory_order_acquire);
+		if (Reason != ECancelReason::None)
+		{
+			return Reason;
+		}
+
+		// Thread-safe test: only compares the object's serial number, never touches the object
+		if (State->bHasOwner && !State->Owner.IsValid(false, true))
+		{
+			return Latch(ECancelReason::OwnerDestroyed);
+		}
+		if (State->Deadline > 0.0 && FPlatformTime::Seconds() >= State->Deadline)
+		{
+			return Latch(ECancelReason::DeadlinePassed);
+		}
+		if (State->Parent.IsValid() && FCancellationToken(State->Parent.ToSharedRef()).IsCancelled())
+		{
+			return Latch(ECancelReason::ParentCancelled);
+		}
+		return ECancelReason::None;
+	}
+
+	// Seconds left before the deadline; a large value if there is none
+	double GetRemainingSeconds() const
+	{
+		return State->Deadline > 0.0 ? FMath::Max(0.0, State->Deadline - FPlatformTime::Seconds()) : TNumericLimits<double>::Max();
+	}
+
+private:
+	struct FState
+	{
+		std::atomic<ECancelReason> Reason{ECancelReason::None};
+		TWeakObjectPtr<const UObject> Owner;
+		bool bHasOwner = false;
+		double Deadline = 0.0;
+		TSharedPtr<FState, ESPMode::ThreadSafe> Parent;
+	};
+
+	FCancellationToken(const UObject* Owner, double TimeoutSeconds, TSharedPtr<FState, ESPMode::ThreadSafe> Parent)
+		: State(MakeShared<FState, ESPMode::ThreadSafe>())
+	{
+		State->Owner = Owner;
+		State->bHasOwner = Owner != nullptr;
+		State->Deadline = TimeoutSeconds > 0.0 ? FPlatformTime::Seconds() + TimeoutSeconds : 0.0;
+		State->Parent = MoveTemp(Parent);
+	}
+
+	explicit FCancellationToken(TSharedRef<FState, ESPMode::ThreadSafe> InState)
+		: State(MoveTemp(InState))
+	{
+	}
+
+	// First reason wins - later checks report the same one
+	ECancelReason Latch(ECancelReason Reason) const
+	{
+		ECancelReason Expected = ECancelReason::None;
+		State->Reason.compare_exchange_strong(Expected, Reason, std::memory_order_acq_rel);
+		return State->Reason.load(std::memory_order_acquire);
+	}
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+};
+
+// Owns a token and cancels it on destruction or Reset(). Game thread member, e.g. one per request kind.
+class FCancellationSource
+{
+public:
+	~FCancellationSource()
+	{
+		Cancel();
+	}
+
+	// Cancels the previous token (if any) and returns a fresh one
+	FCancellationToken Reset(const UObject* Owner = nullptr, double TimeoutSeconds = 0.0)
+	{
+		Cancel();
+		Token = FCancellationToken::ForOwner(Owner, TimeoutSeconds);
+		return *Token;
+	}
+
+	void Cancel()
+	{
+		if (Token.IsSet())
+		{
+			Token->Cancel();
+			Token.Reset();
+		}
+	}
+
+private:
+	TOptional<FCancellationToken> Token;
+};
+
+// Launch that's skipped entirely if Token is already cancelled (returns an empty task, which
+// Wait() treats as complete), and whose body doesn't run if Token was cancelled while it
+// waited for its prerequisites. Body receives the token to check between its own chunks.
+template<typename BodyType, typename... LaunchArgTypes>
+UE::Tasks::FTask LaunchCancellable(const TCHAR* DebugName, const FCancellationToken& Token, BodyType&& Body, LaunchArgTypes&&... LaunchArgs)
+{
+	if (Token.IsCancelled())
+	{
+		return UE::Tasks::FTask();
+	}
+
+	return UE::Tasks::Launch(DebugName, [Token, Body = Forward<BodyType>(Body)]() mutable
+	{
+		if (!Token.IsCancelled())
+		{
+			Body(Token);
+		}
+	}, Forward<LaunchArgTypes>(LaunchArgs)...);
+}
+
+// ParallelForChunked that stops claiming work once Token is cancelled.
+// Returns true if every chunk ran.
+template<typename BodyType>
+bool ParallelForCancellable(int32 Num, const FCancellationToken& Token, BodyType&& Body, const FParallelChunkPolicy& Policy = FParallelChunkPolicy())
+{
+	std::atomic<bool> bStopped{false};
+
+	ParallelForChunked(Num, [&Token, &Body, &bStopped](int32 StartIdx, int32 EndIdx, int32 WorkerIdx)
+	{
+		// Remaining chunks are still claimed, but cost one relaxed load each
+		if (bStopped.load(std::memory_order_relaxed) || Token.IsCancelled())
+		{
+			bStopped.store(true, std::memory_order_relaxed);
+			return;
+		}
+		Body(StartIdx, EndIdx, WorkerIdx);
+	}, Policy);
+
+	return !bStopped.load();
+}
+
+// Example usage
+class FTaskCancellationExamples
+{
+public:
+	// Example 1: Owner-bound work that stops shortly after the owner is garbage collected
+	void OwnerBoundWork(const UObject* Owner)
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Cancellation: Owner Lifetime ==="));
+
+		LaunchCancellable(TEXT("BuildNavCache"), FCancellationToken::ForOwner(Owner), [](const FCancellationToken& Token)
+		{
+			for (int32 Chunk = 0; Chunk < 100; Chunk++)
+			{
+				if (Token.IsCancelled())
+				{
+					UE_LOG(LogTemp, Log, TEXT("Stopped after %d of 100 chunks - owner gone"), Chunk);
+					return;
+				}
+				FPlatformProcess::Sleep(0.01f);  // One chunk of work
+			}
+		});
+	}
+
+	// Example 2: Deadline - take whatever finished in time
+	void DeadlineBoundSearch()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Cancellation: Deadline ==="));
+
+		const FCancellationToken Token = FCancellationToken::Create(0.005);  // 5 ms
+		std::atomic<int32> NumEvaluated{0};
+		std::atomic<float> BestScore{0.0f};
+
+		const bool bComplete = ParallelForCancellable(1000000, Token, [&NumEvaluated, &BestScore](int32 StartIdx, int32 EndIdx, int32)
+		{
+			// Best candidate in this chunk, then merged once - not one atomic per candidate
+			float ChunkBest = 0.0f;
+			for (int32 i = StartIdx; i < EndIdx; i++)
+			{
+				ChunkBest = FMath::Max(ChunkBest, FMath::Frac(FMath::Sqrt(static_cast<float>(i)) * 0.618f));
+			}
+
+			float Previous = BestScore.load(std::memory_order_relaxed);
+			while (ChunkBest > Previous && !BestScore.compare_exchange_weak(Previous, ChunkBest, std::memory_order_relaxed))
+			{
+			}
+			NumEvaluated.fetch_add(EndIdx - StartIdx, std::memory_order_relaxed);
+		});
+
+		UE_LOG(LogTemp, Log, TEXT("Evaluated %d candidates (%s), best score %.6f"), NumEvaluated.load(),
+			bComplete ? TEXT("complete") : TEXT("deadline hit"), BestScore.load());
+	}
+
+	// Example 3: WRONG - checking only at the end
+	void CheckAtTheEndAntiPattern()
+	{
+		/* DON'T DO THIS:
+		UE::Tasks::Launch(TEXT("Work"), [WeakThis]()
+		{
+			HeavyWork();                       // Seconds of work for an actor that may be long gone
+			if (WeakThis.IsValid()) { ... }    // Only now do we find out
+		});
+		*/
+
+		// DO THIS:
+		// LaunchCancellable(TEXT("Work"), FCancellationToken::ForOwner(this), [](const FCancellationToken& Token)
+		// {
+		//     for (chunk) { if (Token.IsCancelled()) return; DoChunk(); }
+		// });
+	}
+};
@@ -0,0 +1,377 @@
+// Example 18: Priority Scheduling
+// Per-priority queue wait / run time counters and reserved workers for latency-sensitive tasks
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Event.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+/*
+ * ETaskPriority decides which queue a task goes into, but nothing tells you what a
+ * priority actually buys you. When a gameplay task launched at High waits 4 ms because
+ * every worker is busy with a long BackgroundNormal batch, that's invisible - task
+ * scheduling is not preemptive, so a running task keeps its worker until it returns.
+ *
+ * FPriorityScheduler::Launch(Name, Priority, Body) is a thin layer over UE::Tasks that
+ * measures, per priority class:
+ * - Queue wait: launch -> body starts (average, max)
+ * - Run time: body start -> end
+ * - Starved: tasks whose queue wait exceeded the class's StarvationThresholdMs
+ * - Inversions: starved tasks that waited while lower priority work was running - the
+ *   "stuck behind bulk work" case. Since the scheduler doesn't preempt, this is the
+ *   closest thing to a missed preemption.
+ *
+ * Reserved workers (optional): Settings.NumReservedWorkers > 0 starts that many
+ * dedicated threads that ONLY run Critical tasks. However much Background work floods the
+ * shared pool, a Critical task waits at most for another Critical task. Other classes
+ * always use the shared UE::Tasks pool.
+ *
+ * Use Critical sparingly - reserved threads compete with the pool for cores, so they
+ * should be idle most of the time.
+ */
+
+enum class ESchedulerPriority : uint8
+{
+	Critical,    // Latency-sensitive gameplay work; reserved workers when configured
+	High,
+	Normal,
+	Background,  // Bulk batch work
+
+	Count
+};
+
+struct FPrioritySchedulerSettings
+{
+	// Dedicated threads for Critical tasks; 0 = Critical uses the shared pool at High priority
+	int32 NumReservedWorkers = 0;
+
+	// Queue wait above which a task counts as starved, per ESchedulerPriority
+	float StarvationThresholdMs[static_cast<int32>(ESchedulerPriority::Count)] = {0.5f, 2.0f, 8.0f, 50.0f};
+};
+
+struct FPriorityClassStats
+{
+	int64 NumLaunched = 0;
+	int64 NumCompleted = 0;
+	double AvgQueueWaitMs = 0.0;
+	double MaxQueueWaitMs = 0.0;
+	double AvgRunMs = 0.0;
+	int64 NumStarved = 0;
+	int64 NumInversions = 0;
+};
+
+class FPriorityScheduler
+{
+public:
+	static constexpr int32 NumPriorities = static_cast<int32>(ESchedulerPriority::Count);
+
+	// Created on first use, never destroyed - tasks may still complete during shutdown
+	static FPriorityScheduler& Get()
+	{
+		static FPriorityScheduler* Instance = new FPriorityScheduler();
+		return *Instance;
+	}
+
+	// Call once at startup. Reserved workers are only ever added, never stopped.
+	void Configure(const FPrioritySchedulerSettings& InSettings)
+	{
+		FScopeLock Lock(&ReservedLock);
+		Settings = InSettings;
+		SetStarvationThresholds(Settings);
+		while (ReservedWorkers.Num() < Settings.NumReservedWorkers)
+		{
+			ReservedWorkers.Add(MakeUnique<FReservedWorker>(*this, ReservedWorkers.Num()));
+		}
+	}
+
+	// Any thread. The returned task completes when Body has run.
+	UE::Tasks::FTask Launch(const TCHAR* DebugName, ESchedulerPriority Priority, TUniqueFunction<void()> Body)
+	{
+		const int32 PriorityIndex = static_cast<int32>(Priority);
+		FCounters& Class = Counters[PriorityIndex];
+		Class.NumLaunched.fetch_add(1, std::memory_order_relaxed);
+
+		FScheduledTask Task;
+		Task.Body = MoveTemp(Body);
+		Task.PriorityIndex = PriorityIndex;
+		Task.LaunchCycles = FPlatformTime::Cycles64();
+
+		if (Priority == ESchedulerPriority::Critical && HasReservedWorkers())
+		{
+			// The reserved thread triggers the event; an empty task on top of it gives callers a normal
+			// FTask. Inline runs it on the triggering thread, so it never queues on the shared pool.
+			UE::Tasks::FTaskEvent Done(DebugName);
+			Task.Done = Done;
+			{
+				FScopeLock Lock(&ReservedLock);
+				ReservedQueue.Add(MoveTemp(Task));
+			}
+			ReservedWake->Trigger();
+			return UE::Tasks::Launch(DebugName, []() {}, UE::Tasks::Prerequisites(Done),
+				UE::Tasks::ETaskPriority::High, UE::Tasks::EExtendedTaskPriority::Inline);
+		}
+
+		return UE::Tasks::Launch(DebugName, [this, Task = MoveTemp(Task)]() mutable
+		{
+			Run(Task);
+		}, ToTaskPriority(Priority));
+	}
+
+	FPriorityClassStats GetStats(ESchedulerPriority Priority) const
+	{
+		const FCounters& Class = Counters[static_cast<int32>(Priority)];
+		FPriorityClassStats Stats;
+		Stats.NumLaunched = Class.NumLaunched.load(std::memory_order_relaxed);
+		Stats.NumCompleted = Class.NumCompleted.load(std::memory_order_relaxed);
+		Stats.NumStarved = Class.NumStarved.load(std::memory_order_relaxed);
+		Stats.NumInversions = Class.NumInversions.load(std::memory_order_relaxed);
+		Stats.MaxQueueWaitMs = FPlatformTime::ToMilliseconds64(Class.MaxQueueWaitCycles.load(std::memory_order_relaxed));
+		if (Stats.NumCompleted > 0)
+		{
+			Stats.AvgQueueWaitMs = FPlatformTime::ToMilliseconds64(Class.TotalQueueWaitCycles.load(std::memory_order_relaxed)) / Stats.NumCompleted;
+			Stats.AvgRunMs = FPlatformTime::ToMilliseconds64(Class.TotalRunCycles.load(std::memory_order_relaxed)) / Stats.NumCompleted;
+		}
+		return Stats;
+	}
+
+	void LogStats() const
+	{
+		static const TCHAR* Names[NumPriorities] = {TEXT("Critical"), TEXT("High"), TEXT("Normal"), TEXT("Background")};
+
+		for (int32 PriorityIndex = 0; PriorityIndex < NumPriorities; PriorityIndex++)
+		{
+			const FPriorityClassStats Stats = GetStats(static_cast<ESchedulerPriority>(PriorityIndex));
+			UE_LOG(LogTemp, Log, TEXT("%-10s %6lld tasks  wait avg %.3f ms max %.3f ms  run avg %.3f ms  starved %lld  inversions %lld"),
+				Names[PriorityIndex], Stats.NumCompleted, Stats.AvgQueueWaitMs, Stats.MaxQueueWaitMs,
+				Stats.AvgRunMs, Stats.NumStarved, Stats.NumInversions);
+		}
+	}
+
+	// Zeroes the counters (e.g. per benchmark run). Tasks in flight still count when they finish.
+	void ResetStats()
+	{
+		for (FCounters& Class : Counters)
+		{
+			Class.NumLaunched = 0;
+			Class.NumCompleted = 0;
+			Class.TotalQueueWaitCycles = 0;
+			Class.MaxQueueWaitCycles = 0;
+			Class.TotalRunCycles = 0;
+			Class.NumStarved = 0;
+			Class.NumInversions = 0;
+		}
+	}
+
+private:
+	struct FScheduledTask
+	{
+		TUniqueFunction<void()> Body;
+		TOptional<UE::Tasks::FTaskEvent> Done;  // Reserved path only
+		int32 PriorityIndex = 0;
+		uint64 LaunchCycles = 0;
+	};
+
+	struct FCounters
+	{
+		std::atomic<int64> NumLaunched{0};
+		std::atomic<int64> NumCompleted{0};
+		std::atomic<uint64> TotalQueueWaitCycles{0};
+		std::atomic<uint64> MaxQueueWaitCycles{0};
+		std::atomic<uint64> TotalRunCycles{0};
+		std::atomic<int64> NumStarved{0};
+		std::atomic<int64> NumInversions{0};
+		std::atomic<int32> NumRunning{0};
+	};
+
+	// A thread that only runs Critical tasks
+	class FReservedWorker : public FRunnable
+	{
+	public:
+		FReservedWorker(FPriorityScheduler& InScheduler, int32 Index)
+			: Scheduler(InScheduler)
+		{
+			Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("ReservedTaskWorker%d"), Index), 0, TPri_AboveNormal);
+		}
+
+		virtual uint32 Run() override
+		{
+			for (;;)
+			{
+				FScheduledTask Task;
+				if (Scheduler.PopReserved(Task))
+				{
+					Scheduler.Run(Task);
+					Task.Done->Trigger();
+				}
+				else
+				{
+					Scheduler.ReservedWake->Wait(100);  // Timeout guards against a missed wake-up
+				}
+			}
+		}
+
+	private:
+		FPriorityScheduler& Scheduler;
+		FRunnableThread* Thread = nullptr;  // Never stopped - owned by the leaked scheduler
+	};
+
+	FPriorityScheduler()
+		: ReservedWake(FPlatformProcess::GetSynchEventFromPool(false))
+	{
+		SetStarvationThresholds(Settings);
+	}
+
+	// Run() reads the thresholds on every task without ReservedLock
+	void SetStarvationThresholds(const FPrioritySchedulerSettings& InSettings)
+	{
+		for (int32 Index = 0; Index < NumPriorities; Index++)
+		{
+			StarvationThresholdMs[Index].store(InSettings.StarvationThresholdMs[Index], std::memory_order_relaxed);
+		}
+	}
+
+	static UE::Tasks::ETaskPriority ToTaskPriority(ESchedulerPriority Priority)
+	{
+		switch (Priority)
+		{
+		case ESchedulerPriority::Critical:
+		case ESchedulerPriority::High:
+			return UE::Tasks::ETaskPriority::High;
+		case ESchedulerPriority::Background:
+			return UE::Tasks::ETaskPriority::BackgroundNormal;
+		default:
+			return UE::Tasks::ETaskPriority::Normal;
+		}
+	}
+
+	bool HasReservedWorkers()
+	{
+		FScopeLock Lock(&ReservedLock);
+		return ReservedWorkers.Num() > 0;
+	}
+
+	bool PopReserved(FScheduledTask& OutTask)
+	{
+		FScopeLock Lock(&ReservedLock);
+		if (ReservedQueue.Num() == 0)
+		{
+			return false;
+		}
+		OutTask = MoveTemp(ReservedQueue[0]);
+		ReservedQueue.RemoveAt(0);  // Critical queues are expected to be short
+		return true;
+	}
+
+	void Run(FScheduledTask& Task)
+	{
+		FCounters& Class = Counters[Task.PriorityIndex];
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const uint64 WaitCycles = StartCycles - Task.LaunchCycles;
+
+		const float ThresholdMs = StarvationThresholdMs[Task.PriorityIndex].load(std::memory_order_relaxed);
+		if (FPlatformTime::ToMilliseconds64(WaitCycles) > ThresholdMs)
+		{
+			Class.NumStarved.fetch_add(1, std::memory_order_relaxed);
+
+			// Waited too long while lower priority work held workers
+			for (int32 Lower = Task.PriorityIndex + 1; Lower < NumPriorities; Lower++)
+			{
+				if (Counters[Lower].NumRunning.load(std::memory_order_relaxed) > 0)
+				{
+					Class.NumInversions.fetch_add(1, std::memory_order_relaxed);
+					break;
+				}
+			}
+		}
+
+		Class.NumRunning.fetch_add(1, std::memory_order_relaxed);
+		Task.Body();
+		Class.NumRunning.fetch_sub(1, std::memory_order_relaxed);
+
+		Class.TotalQueueWaitCycles.fetch_add(WaitCycles, std::memory_order_relaxed);
+		Class.TotalRunCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+		Class.NumCompleted.fetch_add(1, std::memory_order_relaxed);
+
+		uint64 PrevMax = Class.MaxQueueWaitCycles.load(std::memory_order_relaxed);
+		while (WaitCycles > PrevMax && !Class.MaxQueueWaitCycles.compare_exchange_weak(PrevMax, WaitCycles, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	FPrioritySchedulerSettings Settings;  // Guarded by ReservedLock
+	std::atomic<float> StarvationThresholdMs[NumPriorities];
+	FCounters Counters[NumPriorities];
+
+	FCriticalSection ReservedLock;
+	TArray<TUniquePtr<FReservedWorker>> ReservedWorkers;
+	TArray<FScheduledTask> ReservedQueue;
+	FEvent* ReservedWake;
+};
+
+// Example usage
+class FPrioritySchedulingExamples
+{
+public:
+	// Example 1: Gameplay tasks launched while bulk work floods the pool
+	void CriticalUnderLoad(bool bReserveWorkers)
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Priority Scheduling: Critical Under Load (reserved: %s) ==="),
+			bReserveWorkers ? TEXT("yes") : TEXT("no"));
+
+		FPriorityScheduler& Scheduler = FPriorityScheduler::Get();
+		if (bReserveWorkers)
+		{
+			FPrioritySchedulerSettings Settings;
+			Settings.NumReservedWorkers = 1;
+			Scheduler.Configure(Settings);
+		}
+		Scheduler.ResetStats();
+
+		// Bulk: more 20 ms jobs than there are workers
+		TArray<UE::Tasks::FTask> Tasks;
+		const int32 NumBulk = FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 4;
+		for (int32 i = 0; i < NumBulk; i++)
+		{
+			Tasks.Add(Scheduler.Launch(TEXT("BulkBake"), ESchedulerPriority::Background, []()
+			{
+				FPlatformProcess::Sleep(0.02f);
+			}));
+		}
+
+		// Gameplay: short tasks that need an answer this frame
+		for (int32 i = 0; i < 20; i++)
+		{
+			Tasks.Add(Scheduler.Launch(TEXT("HitReaction"), ESchedulerPriority::Critical, []()
+			{
+				FPlatformProcess::Sleep(0.0005f);
+			}));
+			FPlatformProcess::Sleep(0.002f);
+		}
+
+		UE::Tasks::Wait(Tasks);
+
+		// Without reserved workers, Critical max wait approaches one bulk job (20 ms) and inversions
+		// show up; with one reserved worker it stays near zero
+		Scheduler.LogStats();
+	}
+
+	// Example 2: WRONG - everything at High
+	void EverythingHighAntiPattern()
+	{
+		/* DON'T DO THIS:
+		UE::Tasks::Launch(TEXT("BakeLightmapChunk"), [] { ... }, UE::Tasks::ETaskPriority::High);
+		// Bulk work at High competes with the gameplay tasks that actually need it -
+		// a priority that everything uses means nothing
+		*/
+
+		// DO THIS:
+		// FPriorityScheduler::Get().Launch(TEXT("BakeLightmapChunk"), ESchedulerPriority::Background, [] { ... });
+		// and check LogStats(): if Background starves, that's fine; if Critical does, reserve a worker
+	}
+};
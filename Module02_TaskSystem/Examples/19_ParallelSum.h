@@ -0,0 +1,415 @@
+// Example 19: Parallel Summation Engine
+// Overflow-safe, compensated and vectorized sums with one padded accumulator per worker
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+#include "07_ParallelChunking.h"
+#include "08_VectorizedKernels.h"
+#include <type_traits>
+
+/*
+ * "Sum the array" has three separate problems once the arrays get large:
+ *
+ * 1. OVERFLOW - int32 partials wrap after ~2 billion. A few million telemetry counters
+ *    are enough. Accumulate integers in int64.
+ * 2. ROUNDING - adding 16M floats one by one into a float loses most of the small values
+ *    once the running total is large (each add rounds to 24 bits of mantissa).
+ *    - KAHAN: carry the rounding error of every add in a second "compensation" value
+ *      and feed it back into the next add. Error stays ~1 ulp regardless of length.
+ *    - PAIRWISE: split the range in halves recursively and add the half-sums, so each
+ *      value passes through O(log N) adds instead of O(N). Almost as accurate, as fast
+ *      as a naive sum.
+ *    - Or accumulate floats into a double.
+ * 3. THROUGHPUT - a scalar loop does one add per cycle at best. The vector path keeps
+ *    8 lanes (two registers) of sums in flight, and Kahan runs per lane.
+ *
+ * The engine runs on ParallelReduce (see 07_ParallelChunking.h): guided chunks across
+ * workers, one accumulator per worker in its own cache line (no false sharing), and the
+ * partials are merged with compensation at the end.
+ *
+ *   FParallelSumSettings Settings;
+ *   Settings.Mode = ESummationMode::Kahan;
+ *   const double Total = ParallelSum<double>(FrameTimes, Settings);
+ *   const int64 Count = ParallelSum<int64>(EventCounts);
+ *   const int64 Squares = ParallelMapSum<int64>(Num, [&](int32 i) { return (int64)V[i] * V[i]; });
+ *
+ * Accumulators: int64, float, double. Integer sums are exact and ignore Mode.
+ * Vector inner loops: float -> float, float -> double and double -> double. Other
+ * combinations (and ParallelMapSum) use a scalar loop with 4 independent accumulators,
+ * which the compiler can vectorize on its own for integers.
+ *
+ * NOTE: Kahan relies on the compiler NOT reassociating float math (no fast-math),
+ * which is the default for Unreal builds.
+ */
+
+enum class ESummationMode : uint8
+{
+	Naive,     // Plain adds - fastest, error grows with N
+	Kahan,     // Compensated adds - ~2x the work, error independent of N
+	Pairwise   // Recursive halves inside each chunk - error grows with log N
+};
+
+struct FParallelSumSettings
+{
+	ESummationMode Mode = ESummationMode::Pairwise;
+
+	// Vector or scalar inner loop (see 08_VectorizedKernels.h)
+	EFloatKernelPath Path = EFloatKernelPath::Auto;
+
+	FParallelChunkPolicy Policy;
+
+	FParallelSumSettings()
+	{
+		// Summation is cheap per element - large chunks. The vector path aligns them to 8 lanes.
+		Policy.MinChunkSize = 16 * 1024;
+	}
+};
+
+// Running sum plus the rounding error not yet folded in (always 0 for integers)
+template<typename AccType>
+struct TCompensatedSum
+{
+	AccType Sum = AccType(0);
+	AccType Compensation = AccType(0);
+
+	void Add(AccType Value)
+	{
+		if constexpr (std::is_integral_v<AccType>)
+		{
+			Sum += Value;
+		}
+		else
+		{
+			const AccType Corrected = Value - Compensation;
+			const AccType NewSum = Sum + Corrected;
+			Compensation = (NewSum - Sum) - Corrected;  // What the add just rounded away
+			Sum = NewSum;
+		}
+	}
+
+	void Merge(const TCompensatedSum& Other)
+	{
+		Add(Other.Sum);
+		Add(-Other.Compensation);
+	}
+
+	AccType Get() const
+	{
+		return Sum - Compensation;
+	}
+};
+
+namespace ParallelSumPrivate
+{
+	// Below this many elements a pairwise split stops and sums the block directly
+	constexpr int32 PairwiseBlockSize = 256;
+
+	template<typename ValueType, typename AccType>
+	struct TSimdLanes
+	{
+		static constexpr bool bSupported = false;
+	};
+
+	template<>
+	struct TSimdLanes<float, float>
+	{
+		static constexpr bool bSupported = true;
+		using RegisterType = VectorRegister4Float;
+
+		static RegisterType Zero() { return VectorZeroFloat(); }
+		static RegisterType Load(const float* Data) { return VectorLoad(Data); }
+		static void Store(const RegisterType& Value, float* Out) { VectorStore(Value, Out); }
+	};
+
+	// Widening: 4 floats converted to 4 doubles per load
+	template<>
+	struct TSimdLanes<float, double>
+	{
+		static constexpr bool bSupported = true;
+		using RegisterType = VectorRegister4Double;
+
+		static RegisterType Zero() { return VectorZeroDouble(); }
+		static RegisterType Load(const float* Data) { return VectorRegister4Double(VectorLoad(Data)); }
+		static void Store(const RegisterType& Value, double* Out) { VectorStore(Value, Out); }
+	};
+
+	template<>
+	struct TSimdLanes<double, double>
+	{
+		static constexpr bool bSupported = true;
+		using RegisterType = VectorRegister4Double;
+
+		static RegisterType Zero() { return VectorZeroDouble(); }
+		static RegisterType Load(const double* Data) { return VectorLoad(Data); }
+		static void Store(const RegisterType& Value, double* Out) { VectorStore(Value, Out); }
+	};
+
+	// Folds the 4 lanes of a register into a scalar sum
+	template<typename LanesType, typename AccType>
+	void AddLanes(TCompensatedSum<AccType>& Result, const typename LanesType::RegisterType& Value)
+	{
+		alignas(32) AccType Lanes[4];
+		LanesType::Store(Value, Lanes);
+		for (AccType Lane : Lanes)
+		{
+			Result.Add(Lane);
+		}
+	}
+
+	// Scalar loop over [StartIdx, EndIdx) with GetValue(Index). Naive and Pairwise keep
+	// 4 independent sums so the adds don't form one long dependency chain.
+	template<typename AccType, typename GetValueType>
+	TCompensatedSum<AccType> SumRangeScalar(int32 StartIdx, int32 EndIdx, const GetValueType& GetValue, ESummationMode Mode)
+	{
+		TCompensatedSum<AccType> Result;
+
+		if (Mode == ESummationMode::Kahan && !std::is_integral_v<AccType>)
+		{
+			for (int32 i = StartIdx; i < EndIdx; i++)
+			{
+				Result.Add(static_cast<AccType>(GetValue(i)));
+			}
+			return Result;
+		}
+
+		if (Mode == ESummationMode::Pairwise && !std::is_integral_v<AccType> && EndIdx - StartIdx > PairwiseBlockSize)
+		{
+			const int32 MidIdx = StartIdx + (EndIdx - StartIdx) / 2;
+			Result = SumRangeScalar<AccType>(StartIdx, MidIdx, GetValue, Mode);
+			Result.Add(SumRangeScalar<AccType>(MidIdx, EndIdx, GetValue, Mode).Sum);
+			return Result;
+		}
+
+		AccType S0 = AccType(0), S1 = AccType(0), S2 = AccType(0), S3 = AccType(0);
+		int32 i = StartIdx;
+		for (; i + 4 <= EndIdx; i += 4)
+		{
+			S0 += static_cast<AccType>(GetValue(i));
+			S1 += static_cast<AccType>(GetValue(i + 1));
+			S2 += static_cast<AccType>(GetValue(i + 2));
+			S3 += static_cast<AccType>(GetValue(i + 3));
+		}
+		for (; i < EndIdx; i++)
+		{
+			S0 += static_cast<AccType>(GetValue(i));
+		}
+
+		Result.Sum = (S0 + S1) + (S2 + S3);
+		return Result;
+	}
+
+	// Vector loop over Data[0, Num): 8 lanes of sums (two registers), scalar tail
+	template<typename AccType, typename ValueType>
+	TCompensatedSum<AccType> SumRangeVector(const ValueType* Data, int32 Num, ESummationMode Mode)
+	{
+		using FLanes = TSimdLanes<ValueType, AccType>;
+		using FRegister = typename FLanes::RegisterType;
+
+		if (Mode == ESummationMode::Pairwise && Num > PairwiseBlockSize)
+		{
+			// Split on a multiple of 8 so only the rightmost block has a tail
+			const int32 LeftNum = (Num / 2) & ~7;
+			TCompensatedSum<AccType> Result = SumRangeVector<AccType>(Data, LeftNum, Mode);
+			Result.Add(SumRangeVector<AccType>(Data + LeftNum, Num - LeftNum, Mode).Sum);
+			return Result;
+		}
+
+		FRegister SumA = FLanes::Zero(), SumB = FLanes::Zero();
+		int32 i = 0;
+
+		if (Mode == ESummationMode::Kahan)
+		{
+			// Same steps as TCompensatedSum::Add, per lane
+			FRegister CompA = FLanes::Zero(), CompB = FLanes::Zero();
+			for (; i + 8 <= Num; i += 8)
+			{
+				const FRegister CorrectedA = VectorSubtract(FLanes::Load(Data + i), CompA);
+				const FRegister CorrectedB = VectorSubtract(FLanes::Load(Data + i + 4), CompB);
+				const FRegister NewSumA = VectorAdd(SumA, CorrectedA);
+				const FRegister NewSumB = VectorAdd(SumB, CorrectedB);
+				CompA = VectorSubtract(VectorSubtract(NewSumA, SumA), CorrectedA);
+				CompB = VectorSubtract(VectorSubtract(NewSumB, SumB), CorrectedB);
+				SumA = NewSumA;
+				SumB = NewSumB;
+			}
+
+			// Lane sums minus what each lane still owes - the scalar merge carries on compensating
+			SumA = VectorSubtract(SumA, CompA);
+			SumB = VectorSubtract(SumB, CompB);
+		}
+		else
+		{
+			for (; i + 8 <= Num; i += 8)
+			{
+				SumA = VectorAdd(SumA, FLanes::Load(Data + i));
+				SumB = VectorAdd(SumB, FLanes::Load(Data + i + 4));
+			}
+		}
+
+		TCompensatedSum<AccType> Result;
+		AddLanes<FLanes>(Result, SumA);
+		AddLanes<FLanes>(Result, SumB);
+
+		// Scalar tail: 0-7 elements
+		for (; i < Num; i++)
+		{
+			Result.Add(static_cast<AccType>(Data[i]));
+		}
+		return Result;
+	}
+}
+
+/*
+ * Sum of GetValue(Index) for Index in [0, Num), accumulated as AccType.
+ * GetValue runs on several workers at once - it must be thread-safe.
+ */
+template<typename AccType, typename GetValueType>
+AccType ParallelMapSum(int32 Num, GetValueType&& GetValue, const FParallelSumSettings& Settings = FParallelSumSettings())
+{
+	static_assert(std::is_same_v<AccType, int64> || std::is_same_v<AccType, float> || std::is_same_v<AccType, double>,
+		"Accumulate in int64, float or double");
+
+	const TCompensatedSum<AccType> Total = ParallelReduce(Num, TCompensatedSum<AccType>(),
+		[&GetValue, &Settings](int32 StartIdx, int32 EndIdx, TCompensatedSum<AccType>& WorkerSum)
+		{
+			WorkerSum.Merge(ParallelSumPrivate::SumRangeScalar<AccType>(StartIdx, EndIdx, GetValue, Settings.Mode));
+		},
+		[](TCompensatedSum<AccType> A, const TCompensatedSum<AccType>& B)
+		{
+			A.Merge(B);
+			return A;
+		},
+		Settings.Policy);
+
+	return Total.Get();
+}
+
+// Sum of Values accumulated as AccType, with a vector inner loop where one exists
+template<typename AccType, typename ValueType>
+AccType ParallelSum(TConstArrayView<ValueType> Values, const FParallelSumSettings& Settings = FParallelSumSettings())
+{
+	static_assert(std::is_arithmetic_v<ValueType>, "ParallelSum needs arithmetic values - use ParallelMapSum to project");
+
+	if constexpr (ParallelSumPrivate::TSimdLanes<ValueType, AccType>::bSupported)
+	{
+		if (FloatKernels::ResolvePath(Settings.Path) == EFloatKernelPath::Vector)
+		{
+			// Chunk boundaries on the 8-lane loop - only the last chunk has a scalar tail
+			FParallelChunkPolicy AlignedPolicy = Settings.Policy;
+			AlignedPolicy.ChunkAlignment = FMath::Max(AlignedPolicy.ChunkAlignment, 8);
+
+			const TCompensatedSum<AccType> Total = ParallelReduce(Values.Num(), TCompensatedSum<AccType>(),
+				[Values, &Settings](int32 StartIdx, int32 EndIdx, TCompensatedSum<AccType>& WorkerSum)
+				{
+					WorkerSum.Merge(ParallelSumPrivate::SumRangeVector<AccType>(Values.GetData() + StartIdx, EndIdx - StartIdx, Settings.Mode));
+				},
+				[](TCompensatedSum<AccType> A, const TCompensatedSum<AccType>& B)
+				{
+					A.Merge(B);
+					return A;
+				},
+				AlignedPolicy);
+
+			return Total.Get();
+		}
+	}
+
+	return ParallelMapSum<AccType>(Values.Num(), [Values](int32 Index) { return Values[Index]; }, Settings);
+}
+
+template<typename AccType, typename ValueType>
+AccType ParallelSum(const TArray<ValueType>& Values, const FParallelSumSettings& Settings = FParallelSumSettings())
+{
+	return ParallelSum<AccType>(TConstArrayView<ValueType>(Values), Settings);
+}
+
+// Example usage
+class FParallelSumExamples
+{
+public:
+	// Example 1: Integer counters - int64 partials where int32 would wrap
+	void OverflowSafeIntegers()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Parallel Sum: Integers ==="));
+
+		TArray<int32> BytesPerEvent;
+		BytesPerEvent.Init(1500, 4 * 1024 * 1024);  // 4M events of 1500 bytes = 6.3 GB - past int32
+
+		const int64 TotalBytes = ParallelSum<int64>(BytesPerEvent);
+
+		UE_LOG(LogTemp, Log, TEXT("Total bytes: %lld (int32 would report %d)"), TotalBytes, static_cast<int32>(TotalBytes));
+	}
+
+	// Example 2: Float telemetry - naive vs compensated vs widened
+	void FloatAccuracy()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Parallel Sum: Float Accuracy ==="));
+
+		// 16M frame times around 16.67 ms - the exact total is known
+		TArray<float> FrameTimes;
+		FrameTimes.SetNumUninitialized(16 * 1024 * 1024 + 3);  // Not a multiple of 8 - exercises the tail
+		for (int32 i = 0; i < FrameTimes.Num(); i++)
+		{
+			FrameTimes[i] = (i % 2 == 0) ? 16.0f : 17.0f;
+		}
+		const double Expected = 16.5 * (FrameTimes.Num() - 1) + 16.0;
+
+		FParallelSumSettings Settings;
+		for (ESummationMode Mode : { ESummationMode::Naive, ESummationMode::Kahan, ESummationMode::Pairwise })
+		{
+			Settings.Mode = Mode;
+
+			const double Start = FPlatformTime::Seconds();
+			const float Total = ParallelSum<float>(FrameTimes, Settings);
+			const double ElapsedMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+			UE_LOG(LogTemp, Log, TEXT("Mode %d: %.1f (error %.1f) in %.2f ms"),
+				static_cast<int32>(Mode), Total, FMath::Abs(Total - Expected), ElapsedMs);
+		}
+
+		// Widening loads + pairwise: exact for this input, still on the vector path
+		Settings.Mode = ESummationMode::Pairwise;
+		const double Widened = ParallelSum<double>(FrameTimes, Settings);
+		UE_LOG(LogTemp, Log, TEXT("Double accumulator: %.1f (error %.1f)"), Widened, FMath::Abs(Widened - Expected));
+	}
+
+	// Example 3: Derived statistic - mean of squares without a temporary array
+	void MappedSum()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Parallel Sum: Mapped ==="));
+
+		TArray<float> Latencies;
+		for (int32 i = 0; i < 1000000; i++)
+		{
+			Latencies.Add(static_cast<float>(i % 100) * 0.1f);
+		}
+
+		FParallelSumSettings Settings;
+		Settings.Mode = ESummationMode::Kahan;
+
+		const double SumOfSquares = ParallelMapSum<double>(Latencies.Num(), [&Latencies](int32 Index)
+		{
+			return static_cast<double>(Latencies[Index]) * Latencies[Index];
+		}, Settings);
+
+		UE_LOG(LogTemp, Log, TEXT("RMS latency: %.3f"), FMath::Sqrt(SumOfSquares / Latencies.Num()));
+	}
+
+	// Example 4: WRONG - one shared accumulator array without padding
+	void FalseSharingAntiPattern()
+	{
+		/* DON'T DO THIS:
+		int64 Partials[16] = {};   // 8 partials per 64-byte cache line
+		ParallelFor(16, [&](int32 Worker)
+		{
+			for (...) Partials[Worker] += Values[i];   // Neighbouring workers keep stealing the line from each other
+		});
+		*/
+
+		// DO THIS:
+		// const int64 Total = ParallelSum<int64>(Values);   // One cache line per worker partial
+		// Or accumulate into a local and write the partial once per chunk
+	}
+};
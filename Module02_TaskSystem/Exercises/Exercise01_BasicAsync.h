@@ -16,7 +16,7 @@
 class FExercise01_ParallelSum
 {
 public:
-	int32 CalculateParallelSum(const TArray<int32>& Numbers)
+	int64 CalculateParallelSum(const TArray<int32>& Numbers)
 	{
 		// TODO: Implement parallel sum
 		// 1. Divide Numbers into 4 chunks
@@ -25,6 +25,7 @@ public:
 		// 4. Sum the results from all tasks
 
 		// Hint: Use UE::Tasks::Launch and UE::Tasks::Wait
+		// Hint: Sum into int64 - a few million int32 values can overflow an int32 total
 
 		return 0;  // Replace with actual implementation
 	}
@@ -3,7 +3,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Misc/Paths.h"
 #include "Tasks/Task.h"
+#include "../Examples/06_StreamingPipeline.h"
+#include "../Examples/07_ParallelChunking.h"
+#include "../Examples/08_VectorizedKernels.h"
+#include "../Examples/09_StreamingFileLoader.h"
+#include "../Examples/10_GameThreadHandoff.h"
+#include "../Examples/12_WorkerRandom.h"
+#include "../Examples/13_TaskTracing.h"
+#include "../Examples/15_FusedRanges.h"
+#include "../Examples/19_ParallelSum.h"
+#include <atomic>
 
 /*
  * SOLUTION 1: Parallel Sum Implementation
@@ -12,54 +23,23 @@
 class FExercise01_ParallelSum_Solution
 {
 public:
-	int32 CalculateParallelSum(const TArray<int32>& Numbers)
+	int64 CalculateParallelSum(const TArray<int32>& Numbers)
 	{
 		if (Numbers.Num() == 0)
 		{
 			return 0;
 		}
 
-		// Divide into 4 chunks
-		const int32 NumChunks = 4;
-		const int32 ChunkSize = Numbers.Num() / NumChunks;
+		// Instead of 4 fixed chunks, let the summation engine hand out chunks to the workers
+		// (see 19_ParallelSum.h). Each worker sums into its own cache-line-padded int64
+		// partial - no shared state, no false sharing, and no overflow past 2^31.
+		FParallelSumSettings Settings;
+		Settings.Policy.NumWorkers = 4;
+		Settings.Policy.MinChunkSize = 16;
 
-		TArray<UE::Tasks::FTask> Tasks;
+		const int64 TotalSum = ParallelSum<int64>(Numbers, Settings);
 
-		// Launch tasks for each chunk
-		for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ChunkIdx++)
-		{
-			const int32 StartIdx = ChunkIdx * ChunkSize;
-			const int32 EndIdx = (ChunkIdx == NumChunks - 1)
-				? Numbers.Num()
-				: StartIdx + ChunkSize;
-
-			Tasks.Add(UE::Tasks::Launch(
-				TEXT("SumChunk"),
-				[&Numbers, StartIdx, EndIdx]() -> int32
-				{
-					int32 ChunkSum = 0;
-					for (int32 i = StartIdx; i < EndIdx; i++)
-					{
-						ChunkSum += Numbers[i];
-					}
-
-					UE_LOG(LogTemp, Log, TEXT("Chunk sum [%d to %d]: %d"), StartIdx, EndIdx, ChunkSum);
-					return ChunkSum;
-				}
-			));
-		}
-
-		// Wait for all tasks
-		UE::Tasks::Wait(Tasks);
-
-		// Sum the results
-		int32 TotalSum = 0;
-		for (const UE::Tasks::FTask& Task : Tasks)
-		{
-			TotalSum += Task.GetResult();
-		}
-
-		UE_LOG(LogTemp, Log, TEXT("Total sum: %d"), TotalSum);
+		UE_LOG(LogTemp, Log, TEXT("Total sum: %lld"), TotalSum);
 		return TotalSum;
 	}
 };
@@ -78,11 +58,40 @@ public:
 		int32 LineCount;
 	};
 
+	struct FFileTiming
+	{
+		FString FileName;
+		int32 LineCount = 0;
+		double ReadSeconds = 0.0;
+		double ParseSeconds = 0.0;
+		bool bLoaded = false;
+	};
+
+	struct FIngestSummary
+	{
+		TArray<FFileTiming> Files;  // Same order as the input paths
+		int32 FilesLoaded = 0;
+		int64 TotalLines = 0;
+		double TotalReadSeconds = 0.0;
+		double TotalParseSeconds = 0.0;
+		double WallSeconds = 0.0;
+
+		// More time waiting on reads than parsing: raise MaxInFlight or fix the storage, not the parser
+		bool IsIOBound() const { return TotalReadSeconds > TotalParseSeconds; }
+
+		void LogSummary() const
+		{
+			UE_LOG(LogTemp, Log, TEXT("Ingested %d/%d files, %lld lines in %.1f ms (read %.1f ms, parse %.1f ms summed) - %s bound"),
+				FilesLoaded, Files.Num(), TotalLines, WallSeconds * 1000.0, TotalReadSeconds * 1000.0,
+				TotalParseSeconds * 1000.0, IsIOBound() ? TEXT("I/O") : TEXT("CPU"));
+		}
+	};
+
 	void ProcessFilesAsync(const TArray<FString>& FilePaths)
 	{
 		UE_LOG(LogTemp, Log, TEXT("=== Processing %d files asynchronously ==="), FilePaths.Num());
 
-		TArray<UE::Tasks::FTask> FileTasks;
+		TArray<UE::Tasks::TTask<FFileData>> FileTasks;
 
 		// Launch task for each file
 		for (const FString& FilePath : FilePaths)
@@ -102,9 +111,9 @@ public:
 
 		// Combine results
 		int32 TotalLines = 0;
-		for (const UE::Tasks::FTask& Task : FileTasks)
+		for (UE::Tasks::TTask<FFileData>& Task : FileTasks)
 		{
-			FFileData Data = Task.GetResult();
+			FFileData& Data = Task.GetResult();
 			TotalLines += Data.LineCount;
 
 			UE_LOG(LogTemp, Log, TEXT("File: %s, Lines: %d"), *Data.FileName, Data.LineCount);
@@ -113,17 +122,117 @@ public:
 		UE_LOG(LogTemp, Log, TEXT("Total lines across all files: %d"), TotalLines);
 	}
 
+	/*
+	 * Capped-concurrency version for large file counts:
+	 * - Only MaxInFlight files are being read at any time. Each worker task claims the next
+	 *   path when it finishes one, so thousands of files never become thousands of queued reads.
+	 * - Line counts are aggregated as each file finishes, not after a full Wait.
+	 * - Nothing blocks: the returned task completes with the summary. Continue from it with
+	 *   Prerequisites, or call GetResult() only where blocking is acceptable.
+	 *
+	 * Existing files are loaded with FStreamedTextFile (09_StreamingFileLoader.h); missing
+	 * files fall back to the simulated load so the exercise runs without data on disk.
+	 */
+	UE::Tasks::TTask<FIngestSummary> ProcessFilesAsyncCapped(const TArray<FString>& FilePaths, int32 MaxInFlight = 4)
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Processing %d files, at most %d in flight ==="), FilePaths.Num(), MaxInFlight);
+
+		// Shared by the workers and the summary task - outlives this call
+		struct FIngestState
+		{
+			TArray<FString> FilePaths;
+			TArray<FFileTiming> Timings;  // Each slot is written by exactly one worker
+			std::atomic<int32> NextFile{0};
+			std::atomic<int32> FilesDone{0};
+			std::atomic<int64> TotalLines{0};
+			double StartSeconds = 0.0;
+		};
+
+		TSharedRef<FIngestState, ESPMode::ThreadSafe> State = MakeShared<FIngestState, ESPMode::ThreadSafe>();
+		State->FilePaths = FilePaths;
+		State->Timings.SetNum(FilePaths.Num());
+		State->StartSeconds = FPlatformTime::Seconds();
+
+		const int32 NumWorkers = FMath::Clamp(MaxInFlight, 1, FMath::Max(1, FilePaths.Num()));
+
+		TArray<UE::Tasks::FTask> Workers;
+		for (int32 WorkerIdx = 0; WorkerIdx < NumWorkers; WorkerIdx++)
+		{
+			Workers.Add(UE::Tasks::Launch(TEXT("IngestWorker"), [State]()
+			{
+				for (int32 FileIdx = State->NextFile++; FileIdx < State->FilePaths.Num(); FileIdx = State->NextFile++)
+				{
+					FFileTiming& Timing = State->Timings[FileIdx];
+					Timing = LoadAndTime(State->FilePaths[FileIdx]);
+
+					// Aggregate as soon as this file is done
+					State->TotalLines += Timing.LineCount;
+					const int32 Done = ++State->FilesDone;
+
+					UE_LOG(LogTemp, Verbose, TEXT("[%d/%d] %s: %d lines (read %.2f ms, parse %.2f ms), %lld lines so far"),
+						Done, State->FilePaths.Num(), *Timing.FileName, Timing.LineCount,
+						Timing.ReadSeconds * 1000.0, Timing.ParseSeconds * 1000.0, State->TotalLines.load());
+				}
+			}));
+		}
+
+		// Runs once every worker has exited - no thread blocks waiting for it
+		return UE::Tasks::Launch(TEXT("IngestSummary"), [State]() -> FIngestSummary
+		{
+			FIngestSummary Summary;
+			Summary.TotalLines = State->TotalLines.load();
+			Summary.WallSeconds = FPlatformTime::Seconds() - State->StartSeconds;
+
+			for (const FFileTiming& Timing : State->Timings)
+			{
+				Summary.FilesLoaded += Timing.bLoaded ? 1 : 0;
+				Summary.TotalReadSeconds += Timing.ReadSeconds;
+				Summary.TotalParseSeconds += Timing.ParseSeconds;
+			}
+
+			Summary.Files = MoveTemp(State->Timings);
+			return Summary;
+		}, UE::Tasks::Prerequisites(Workers));
+	}
+
 private:
-	FFileData SimulateLoadFile(const FString& FilePath)
+	static FFileData SimulateLoadFile(const FString& FilePath)
 	{
 		FPlatformProcess::Sleep(0.1f);
 
 		FFileData Data;
 		Data.FileName = FilePath;
-		Data.LineCount = FMath::RandRange(10, 100);
+		Data.LineCount = FWorkerRandom::ForThread().RandRange(10, 100);  // Runs on task threads - no global RNG
 
 		return Data;
 	}
+
+	static FFileTiming LoadAndTime(const FString& FilePath)
+	{
+		FFileTiming Timing;
+		Timing.FileName = FilePath;
+
+		if (FPaths::FileExists(FilePath))
+		{
+			if (TUniquePtr<FStreamedTextFile> File = FStreamedTextFile::Load(FilePath))
+			{
+				Timing.LineCount = File->GetLines().Num();
+				Timing.ReadSeconds = File->GetReadSeconds();
+				Timing.ParseSeconds = File->GetParseSeconds();
+				Timing.bLoaded = true;
+			}
+			return Timing;
+		}
+
+		// Simulated: the sleep stands in for the read, the line count for the parse
+		const double ReadStart = FPlatformTime::Seconds();
+		FFileData Data = SimulateLoadFile(FilePath);
+		Timing.ReadSeconds = FPlatformTime::Seconds() - ReadStart;
+
+		Timing.LineCount = Data.LineCount;
+		Timing.bLoaded = true;
+		return Timing;
+	}
 };
 
 /*
@@ -145,7 +254,7 @@ public:
 			TArray<int32> Data;
 			for (int32 i = 0; i < 100; i++)
 			{
-				Data.Add(FMath::RandRange(1, 100));
+				Data.Add(FWorkerRandom::ForThread().RandRange(1, 100));
 			}
 
 			UE_LOG(LogTemp, Log, TEXT("Loaded %d numbers"), Data.Num());
@@ -222,6 +331,113 @@ public:
 		int32 FinalResult = AggregateTask.GetResult();
 		UE_LOG(LogTemp, Log, TEXT("Pipeline complete! Result: %d"), FinalResult);
 	}
+
+	// ALTERNATIVE: Same four stages fused into one parallel pass (see 15_FusedRanges.h).
+	// Each chunk generates, filters, squares and sums its values in a single loop -
+	// no TArray per stage, no task per stage. Values come from per-index random streams,
+	// so the result doesn't depend on which worker ran which chunk.
+	void RunFusedPipeline()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Fused Task Pipeline ==="));
+
+		const int32 FinalResult = MakeFusedGenerate(100, [](int32 Index)
+			{
+				return FWorkerRandom::ForTask(Index).RandRange(1, 100);   // Load
+			})
+			.Filter([](int32 Value) { return Value % 2 == 0; })           // Filter
+			.Map([](int32 Value) { return Value * Value; })               // Transform
+			.Sum();                                                       // Aggregate
+
+		UE_LOG(LogTemp, Log, TEXT("Fused pipeline complete! Result: %d"), FinalResult);
+	}
+
+	// PROFILING: Same four stages launched through FTaskTraceSession (see 13_TaskTracing.h).
+	// In a linear pipeline every stage is on the critical path - the report shows which one
+	// dominates, and the exported JSON opens in chrome://tracing.
+	void RunTracedPipeline()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Traced Task Pipeline ==="));
+
+		FTaskTraceSession Trace(TEXT("TaskPipeline"));
+
+		auto LoadTask = Trace.Launch(TEXT("LoadData"), []() -> TArray<int32>
+		{
+			TArray<int32> Data;
+			for (int32 i = 0; i < 100; i++)
+			{
+				Data.Add(FWorkerRandom::ForThread().RandRange(1, 100));
+			}
+			return Data;
+		});
+
+		auto FilterTask = Trace.Launch(TEXT("FilterData"), [LoadTask]() -> TArray<int32>
+		{
+			return LoadTask.GetResult().FilterByPredicate([](int32 Value) { return Value % 2 == 0; });
+		}, LoadTask);
+
+		auto TransformTask = Trace.Launch(TEXT("TransformData"), [FilterTask]() -> TArray<int32>
+		{
+			TArray<int32> TransformedData = FilterTask.GetResult();
+			for (int32& Value : TransformedData)
+			{
+				Value *= Value;
+			}
+			return TransformedData;
+		}, FilterTask);
+
+		auto AggregateTask = Trace.Launch(TEXT("AggregateData"), [TransformTask]() -> int32
+		{
+			int32 Sum = 0;
+			for (int32 Value : TransformTask.GetResult())
+			{
+				Sum += Value;
+			}
+			return Sum;
+		}, TransformTask);
+
+		UE_LOG(LogTemp, Log, TEXT("Traced pipeline result: %d"), AggregateTask.GetResult());
+
+		Trace.Analyze().Log(*Trace.GetName());
+		Trace.ExportChromeTrace(FPaths::ProfilingDir() / TEXT("TaskPipeline.json"));
+	}
+
+	// ALTERNATIVE: Same stages as a streaming pipeline (see 06_StreamingPipeline.h)
+	// Items flow through bounded buffers one at a time instead of materializing a
+	// TArray per stage, and any slow stage can be given more workers.
+	// Returns immediately - the task completes with the sum once the pipeline drains.
+	UE::Tasks::TTask<int32> RunStreamingPipeline()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Streaming Task Pipeline ==="));
+
+		auto Pipeline = MakePipeline<int32>(32)
+			.Filter(TEXT("FilterData"), [](const int32& Value) { return Value % 2 == 0; })
+			.Then(TEXT("TransformData"), [](int32 Value) { return Value * Value; }, 2);
+
+		// The sink runs after this function returns - it can't write to a local
+		TSharedRef<int32, ESPMode::ThreadSafe> Sum = MakeShared<int32, ESPMode::ThreadSafe>(0);
+
+		UE::Tasks::TTask<FPipelineStats> Run = Pipeline.RunAsync(
+			// Stage 1: Load data
+			[](TBoundedChannel<int32>& Source)
+			{
+				for (int32 i = 0; i < 100; i++)
+				{
+					Source.Push(FWorkerRandom::ForThread().RandRange(1, 100));
+				}
+			},
+			// Stage 4: Aggregate - one thread at a time, no synchronization needed
+			[Sum](int32&& Value)
+			{
+				*Sum += Value;
+			});
+
+		return UE::Tasks::Launch(TEXT("ReportPipeline"), [Run, Sum]()
+		{
+			Run.GetResult().LogStats();
+			UE_LOG(LogTemp, Log, TEXT("Streaming pipeline complete! Result: %d"), *Sum);
+			return *Sum;
+		}, UE::Tasks::Prerequisites(Run));
+	}
 };
 
 /*
@@ -252,15 +468,13 @@ public:
 				ResultCount++;
 			}
 
-			// Return to game thread for UObject access
-			AsyncTask(ENamedThreads::GameThread, [WeakThis, ResultCount]()
+			// Return to game thread for UObject access - one small completion, so it goes through
+			// the per-frame queue; the weak pointer is checked once on arrival (see 10_GameThreadHandoff.h)
+			FGameThreadHandoffQueue::Get().Enqueue(WeakThis, ResultCount, [](UExercise04_Component_Solution& Component, int32 Count)
 			{
 				// Safe: On game thread
-				if (WeakThis.IsValid())
-				{
-					WeakThis->ProcessedCount = ResultCount;
-					UE_LOG(LogTemp, Log, TEXT("Safely updated ProcessedCount to %d"), ResultCount);
-				}
+				Component.ProcessedCount = Count;
+				UE_LOG(LogTemp, Log, TEXT("Safely updated ProcessedCount to %d"), Count);
 			});
 		});
 	}
@@ -273,61 +487,41 @@ public:
 class FExercise05_OptimalBatching_Solution
 {
 public:
-	TArray<float> ProcessLargeDataset(const TArray<float>& Input)
+	// Scalar processes one float per iteration; Vector adds SIMD inside each chunk
+	// (see 08_VectorizedKernels.h), Auto picks Vector wherever the platform supports it
+	TArray<float> ProcessLargeDataset(const TArray<float>& Input, EFloatKernelPath KernelPath = EFloatKernelPath::Scalar)
 	{
 		if (Input.Num() == 0)
 		{
 			return TArray<float>();
 		}
 
-		// Calculate optimal batch size
-		const int32 NumCores = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
-		const int32 MinBatchSize = 1000;
-		const int32 OptimalBatchSize = FMath::Max(MinBatchSize, Input.Num() / NumCores);
-
-		const int32 NumBatches = (Input.Num() + OptimalBatchSize - 1) / OptimalBatchSize;
+		// Guided chunking replaces the fixed batch math: large chunks first, smaller ones
+		// as work runs out, never below MinChunkSize (see 07_ParallelChunking.h)
+		FParallelChunkPolicy Policy;
+		Policy.MinChunkSize = 1024;  // The vector path aligns chunks to 8, so only the last one has a tail
 
-		UE_LOG(LogTemp, Log, TEXT("Processing %d items with %d cores, batch size %d (%d batches)"),
-			Input.Num(), NumCores, OptimalBatchSize, NumBatches);
+		const EFloatKernelPath ResolvedPath = FloatKernels::ResolvePath(KernelPath);
 
-		// Results array per batch
-		TArray<TArray<float>> BatchResults;
-		BatchResults.SetNum(NumBatches);
+		UE_LOG(LogTemp, Log, TEXT("Processing %d items with %d workers, min chunk %d, %s kernel"),
+			Input.Num(), Policy.ResolveNumWorkers(Input.Num()), Policy.MinChunkSize, FloatKernels::PathToString(ResolvedPath));
 
-		TArray<UE::Tasks::FTask> Tasks;
+		TArray<float> FinalResults;
 
-		// Create batched tasks
-		for (int32 BatchIdx = 0; BatchIdx < NumBatches; BatchIdx++)
+		if (ResolvedPath == EFloatKernelPath::Vector)
 		{
-			const int32 StartIdx = BatchIdx * OptimalBatchSize;
-			const int32 EndIdx = FMath::Min(StartIdx + OptimalBatchSize, Input.Num());
-
-			Tasks.Add(UE::Tasks::Launch(
-				TEXT("ProcessBatch"),
-				[this, &Input, &BatchResults, BatchIdx, StartIdx, EndIdx]()
-				{
-					for (int32 i = StartIdx; i < EndIdx; i++)
-					{
-						float Result = ComplexCalculation(Input[i]);
-						BatchResults[BatchIdx].Add(Result);
-					}
-
-					UE_LOG(LogTemp, Log, TEXT("Batch %d complete (%d items)"),
-						BatchIdx, BatchResults[BatchIdx].Num());
-				}
-			));
+			// Multicore across chunks, 4 lanes per instruction inside each chunk
+			FinalResults.SetNumUninitialized(Input.Num());
+			FloatKernels::ParallelSqrtSinSquare(Input, FinalResults, ResolvedPath, Policy);
 		}
-
-		// Wait for all batches
-		UE::Tasks::Wait(Tasks);
-
-		// Merge results
-		TArray<float> FinalResults;
-		FinalResults.Reserve(Input.Num());
-
-		for (const TArray<float>& Batch : BatchResults)
+		else
 		{
-			FinalResults.Append(Batch);
+			// Results are written straight into a presized array at each chunk's offset,
+			// so there are no per-batch arrays to grow and nothing to merge afterwards
+			FinalResults = ParallelTransform(Input, [this](float Value)
+			{
+				return ComplexCalculation(Value);
+			}, Policy);
 		}
 
 		UE_LOG(LogTemp, Log, TEXT("Processing complete! %d results"), FinalResults.Num());
@@ -355,8 +549,8 @@ inline void RunExercise01Solutions()
 			Numbers.Add(i);
 		}
 
-		int32 Result = Solution.CalculateParallelSum(Numbers);
-		UE_LOG(LogTemp, Log, TEXT("Parallel sum result: %d (expected 5050)\n"), Result);
+		const int64 Result = Solution.CalculateParallelSum(Numbers);
+		UE_LOG(LogTemp, Log, TEXT("Parallel sum result: %lld (expected 5050)\n"), Result);
 	}
 
 	// Test async file processing
@@ -370,6 +564,10 @@ inline void RunExercise01Solutions()
 		};
 
 		Solution.ProcessFilesAsync(Files);
+
+		// Capped version: returns immediately, the summary task completes later
+		UE::Tasks::TTask<FExercise02_AsyncFileProcessing_Solution::FIngestSummary> Ingest = Solution.ProcessFilesAsyncCapped(Files, 2);
+		Ingest.GetResult().LogSummary();  // Blocking here only because this is a test
 		UE_LOG(LogTemp, Log, TEXT(""));
 	}
 
@@ -377,6 +575,9 @@ inline void RunExercise01Solutions()
 	{
 		FExercise03_TaskPipeline_Solution Solution;
 		Solution.RunPipeline();
+		Solution.RunStreamingPipeline().Wait();  // Blocking here only because this is a test
+		Solution.RunFusedPipeline();
+		Solution.RunTracedPipeline();
 		UE_LOG(LogTemp, Log, TEXT(""));
 	}
 
@@ -390,6 +591,7 @@ inline void RunExercise01Solutions()
 		}
 
 		TArray<float> Results = Solution.ProcessLargeDataset(LargeDataset);
+		TArray<float> VectorResults = Solution.ProcessLargeDataset(LargeDataset, EFloatKernelPath::Vector);
 		UE_LOG(LogTemp, Log, TEXT(""));
 	}
 }
@@ -0,0 +1,250 @@
+// Example 1: Benchmark Harness
+// Times parallel patterns across data sizes and worker counts, reports CSV
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/FileHelper.h"
+#include "Tasks/Task.h"
+
+/*
+ * FBenchmarkHarness runs every registered pattern for every (size, worker count) pair:
+ *
+ * - Warmup iterations first (page faults, caches, task worker spin-up)
+ * - Then N timed iterations; the MEDIAN is reported because one preempted run skews a mean
+ * - Each pattern reports how many tasks it launched, so launch overhead can be separated
+ *   from useful work using the measured per-task launch cost
+ * - Scaling efficiency compares each worker count against the 1-worker run of the same
+ *   pattern and size: Efficiency = (T1 / Tn) / n. 1.0 is perfect linear scaling.
+ *
+ * "Workers" means the number of tasks a pattern splits its work into. The task scheduler's
+ * thread count is fixed for the process, so worker counts above the hardware thread count
+ * only measure oversubscription.
+ */
+
+// Data shared by every pattern for one size: inputs are generated once, outputs are presized
+struct FBenchmarkData
+{
+	TArray<float> Input;
+	TArray<float> Output;
+
+	void Init(int32 NumElements)
+	{
+		Input.SetNumUninitialized(NumElements);
+		for (int32 i = 0; i < NumElements; i++)
+		{
+			Input[i] = static_cast<float>(i % 10000);
+		}
+
+		Output.SetNumZeroed(NumElements);
+	}
+};
+
+struct FBenchmarkResult
+{
+	FString Pattern;
+	int32 NumElements = 0;
+	int32 NumWorkers = 0;
+	int32 Iterations = 0;
+	int32 TasksLaunched = 0;
+	double MedianSeconds = 0.0;
+	double MinSeconds = 0.0;
+
+	// Filled in after all runs - needs the 1-worker baseline
+	double Speedup = 0.0;
+	double ScalingEfficiency = 0.0;
+
+	double GetItemsPerSecond() const
+	{
+		return MedianSeconds > 0.0 ? NumElements / MedianSeconds : 0.0;
+	}
+
+	// Fraction of wall time explained by launching and retiring tasks alone
+	double GetLaunchOverheadFraction(double LaunchOverheadSeconds) const
+	{
+		return MedianSeconds > 0.0 ? FMath::Min(1.0, TasksLaunched * LaunchOverheadSeconds / MedianSeconds) : 0.0;
+	}
+};
+
+class FBenchmarkHarness
+{
+public:
+	struct FConfig
+	{
+		// 1e8 floats = 400MB input + 400MB output; drop the last size on memory-constrained targets
+		TArray<int32> Sizes = {1000, 10000, 100000, 1000000, 10000000, 100000000};
+		TArray<int32> WorkerCounts = {1, 2, 4, 8, 16};
+		int32 WarmupIterations = 1;
+		int32 Iterations = 5;
+	};
+
+	// Runs one pattern once. Returns the number of tasks it launched.
+	using FPatternFunc = TFunction<int32(FBenchmarkData& Data, int32 NumWorkers)>;
+
+	// MaxElements lets expensive patterns (one task per item) skip the large sizes
+	void AddPattern(const TCHAR* Name, FPatternFunc Func, int32 MaxElements = MAX_int32, bool bUsesWorkerCount = true)
+	{
+		FPattern& Pattern = Patterns.AddDefaulted_GetRef();
+		Pattern.Name = Name;
+		Pattern.Func = MoveTemp(Func);
+		Pattern.MaxElements = MaxElements;
+		Pattern.bUsesWorkerCount = bUsesWorkerCount;
+	}
+
+	TArray<FBenchmarkResult> RunAll(const FConfig& Config)
+	{
+		TArray<FBenchmarkResult> Results;
+		FBenchmarkData Data;
+
+		for (int32 NumElements : Config.Sizes)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Benchmark: generating %d elements"), NumElements);
+			Data.Init(NumElements);
+
+			for (const FPattern& Pattern : Patterns)
+			{
+				if (NumElements > Pattern.MaxElements)
+				{
+					continue;
+				}
+
+				// Patterns that pick their own worker count only need one run per size
+				const TArray<int32> WorkerCounts = Pattern.bUsesWorkerCount ? Config.WorkerCounts : TArray<int32>{0};
+
+				for (int32 NumWorkers : WorkerCounts)
+				{
+					Results.Add(RunPattern(Pattern, Data, NumElements, NumWorkers, Config));
+
+					const FBenchmarkResult& Last = Results.Last();
+					UE_LOG(LogTemp, Log, TEXT("  %-24s n=%-10d workers=%-3d %10.3f ms  %12.0f items/s"),
+						*Last.Pattern, Last.NumElements, Last.NumWorkers, Last.MedianSeconds * 1000.0, Last.GetItemsPerSecond());
+				}
+			}
+		}
+
+		ComputeScaling(Results);
+		return Results;
+	}
+
+	// Median cost of launching an empty task and waiting for it, measured in batches
+	static double MeasureTaskLaunchOverhead(int32 NumTasks = 10000)
+	{
+		TArray<double> Samples;
+
+		for (int32 Run = 0; Run < 5; Run++)
+		{
+			TArray<UE::Tasks::FTask> Tasks;
+			Tasks.Reserve(NumTasks);
+
+			const double Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumTasks; i++)
+			{
+				Tasks.Add(UE::Tasks::Launch(TEXT("EmptyTask"), []() {}));
+			}
+			UE::Tasks::Wait(Tasks);
+
+			Samples.Add((FPlatformTime::Seconds() - Start) / NumTasks);
+		}
+
+		return Median(Samples);
+	}
+
+	static FString ToCsv(const TArray<FBenchmarkResult>& Results, double LaunchOverheadSeconds)
+	{
+		FString Csv = TEXT("Pattern,Elements,Workers,Iterations,TasksLaunched,MedianMs,MinMs,ItemsPerSec,LaunchOverheadPct,Speedup,ScalingEfficiency\n");
+
+		for (const FBenchmarkResult& Result : Results)
+		{
+			Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%.4f,%.4f,%.0f,%.2f,%.3f,%.3f\n"),
+				*Result.Pattern, Result.NumElements, Result.NumWorkers, Result.Iterations, Result.TasksLaunched,
+				Result.MedianSeconds * 1000.0, Result.MinSeconds * 1000.0, Result.GetItemsPerSecond(),
+				Result.GetLaunchOverheadFraction(LaunchOverheadSeconds) * 100.0,
+				Result.Speedup, Result.ScalingEfficiency);
+		}
+
+		return Csv;
+	}
+
+	static bool SaveCsv(const FString& FilePath, const TArray<FBenchmarkResult>& Results, double LaunchOverheadSeconds)
+	{
+		const bool bSaved = FFileHelper::SaveStringToFile(ToCsv(Results, LaunchOverheadSeconds), *FilePath);
+
+		UE_LOG(LogTemp, Log, TEXT("Benchmark CSV %s: %s"), bSaved ? TEXT("written") : TEXT("FAILED"), *FilePath);
+		return bSaved;
+	}
+
+private:
+	struct FPattern
+	{
+		FString Name;
+		FPatternFunc Func;
+		int32 MaxElements = MAX_int32;
+		bool bUsesWorkerCount = true;
+	};
+
+	TArray<FPattern> Patterns;
+
+	static FBenchmarkResult RunPattern(const FPattern& Pattern, FBenchmarkData& Data, int32 NumElements,
+		int32 NumWorkers, const FConfig& Config)
+	{
+		for (int32 i = 0; i < Config.WarmupIterations; i++)
+		{
+			Pattern.Func(Data, NumWorkers);
+		}
+
+		TArray<double> Samples;
+		int32 TasksLaunched = 0;
+
+		for (int32 i = 0; i < FMath::Max(1, Config.Iterations); i++)
+		{
+			const double Start = FPlatformTime::Seconds();
+			TasksLaunched = Pattern.Func(Data, NumWorkers);
+			Samples.Add(FPlatformTime::Seconds() - Start);
+		}
+
+		FBenchmarkResult Result;
+		Result.Pattern = Pattern.Name;
+		Result.NumElements = NumElements;
+		Result.NumWorkers = NumWorkers;
+		Result.Iterations = Samples.Num();
+		Result.TasksLaunched = TasksLaunched;
+		Result.MedianSeconds = Median(Samples);
+		Result.MinSeconds = FMath::Min(Samples);
+		return Result;
+	}
+
+	// Speedup and efficiency relative to the smallest worker count of the same pattern and size
+	static void ComputeScaling(TArray<FBenchmarkResult>& Results)
+	{
+		for (FBenchmarkResult& Result : Results)
+		{
+			const FBenchmarkResult* Baseline = nullptr;
+
+			for (const FBenchmarkResult& Candidate : Results)
+			{
+				if (Candidate.Pattern == Result.Pattern && Candidate.NumElements == Result.NumElements
+					&& (!Baseline || Candidate.NumWorkers < Baseline->NumWorkers))
+				{
+					Baseline = &Candidate;
+				}
+			}
+
+			if (Baseline && Result.MedianSeconds > 0.0 && Baseline->NumWorkers > 0)
+			{
+				Result.Speedup = Baseline->MedianSeconds / Result.MedianSeconds;
+				Result.ScalingEfficiency = Result.Speedup * Baseline->NumWorkers / Result.NumWorkers;
+			}
+		}
+	}
+
+	static double Median(TArray<double> Samples)
+	{
+		if (Samples.Num() == 0)
+		{
+			return 0.0;
+		}
+
+		Samples.Sort();
+		return Samples[Samples.Num() / 2];
+	}
+};
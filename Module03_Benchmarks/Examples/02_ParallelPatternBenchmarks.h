@@ -0,0 +1,317 @@
+// Example 2: Parallel Pattern Benchmarks
+// Every way Module 2 teaches to split the same work, measured side by side
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+#include "01_BenchmarkHarness.h"
+#include "../../Module02_TaskSystem/Examples/07_ParallelChunking.h"
+#include "../../Module02_TaskSystem/Exercises/Exercise01_BasicAsync_Solution.h"
+#include <atomic>
+
+/*
+ * Each kernel reproduces the splitting strategy of one Module 2 sample with the data size
+ * and worker count taken as parameters (the samples themselves use fixed sizes):
+ *
+ *   FanOut            - FParallelPatterns::ParallelForEach: one task per worker, per-worker arrays, merge
+ *   MapReduce         - FParallelPatterns::MapReduce: static split, TTask partial sums, reduce task
+ *   ManualBatching    - FParallelPatterns::OptimalBatching (original): max(10000, N / Workers) batches + merge
+ *   TaskReturnsArray  - ATaskExampleActor::ParallelProcessing: tasks return TArray by value, aggregator appends
+ *   TaskPerItem       - the "too many tiny tasks" anti-pattern, capped to small sizes
+ *   LegacyAsyncTask   - AsyncTask(AnyBackgroundThreadNormalTask) batches joined with an event
+ *   GuidedTransform   - ParallelTransform from 07_ParallelChunking.h (presized output, guided chunks)
+ *   GuidedReduce      - ParallelReduce from 07_ParallelChunking.h
+ *   Exercise05        - FExercise05_OptimalBatching_Solution::ProcessLargeDataset, as shipped
+ *   Exercise05Vector  - the same, with the VectorRegister4Float kernel inside each chunk
+ *
+ * All kernels except Exercise05 do the same per-item work as OptimalBatching, so differences
+ * are due to the splitting strategy alone. Exercise05 computes Sqrt(Sin(X * X)) - compare
+ * its two rows with each other, not with the other patterns.
+ */
+class FParallelPatternBenchmarks
+{
+public:
+	static float Work(float Value)
+	{
+		return FMath::Sin(Value) * FMath::Cos(Value) + FMath::Sqrt(Value);
+	}
+
+	static int32 FanOut(FBenchmarkData& Data, int32 NumWorkers)
+	{
+		const int32 Num = Data.Input.Num();
+		const int32 ItemsPerWorker = FMath::Max(1, Num / NumWorkers);
+
+		TArray<TArray<float>> PerWorkerResults;
+		PerWorkerResults.SetNum(NumWorkers);
+
+		TArray<UE::Tasks::FTask> Tasks;
+		for (int32 WorkerIdx = 0; WorkerIdx < NumWorkers; WorkerIdx++)
+		{
+			const int32 StartIdx = WorkerIdx * ItemsPerWorker;
+			const int32 EndIdx = (WorkerIdx == NumWorkers - 1) ? Num : StartIdx + ItemsPerWorker;
+
+			if (StartIdx < Num)
+			{
+				Tasks.Add(UE::Tasks::Launch(TEXT("FanOut"), [&Data, &PerWorkerResults, WorkerIdx, StartIdx, EndIdx]()
+				{
+					for (int32 i = StartIdx; i < EndIdx; i++)
+					{
+						PerWorkerResults[WorkerIdx].Add(Work(Data.Input[i]));
+					}
+				}));
+			}
+		}
+
+		UE::Tasks::Wait(Tasks);
+
+		int32 OutIdx = 0;
+		for (const TArray<float>& WorkerResults : PerWorkerResults)
+		{
+			FMemory::Memcpy(&Data.Output[OutIdx], WorkerResults.GetData(), WorkerResults.Num() * sizeof(float));
+			OutIdx += WorkerResults.Num();
+		}
+
+		return Tasks.Num();
+	}
+
+	static int32 MapReduce(FBenchmarkData& Data, int32 NumWorkers)
+	{
+		const int32 Num = Data.Input.Num();
+		const int32 ItemsPerWorker = FMath::Max(1, Num / NumWorkers);
+
+		TArray<UE::Tasks::TTask<double>> MapTasks;
+		for (int32 WorkerIdx = 0; WorkerIdx < NumWorkers; WorkerIdx++)
+		{
+			const int32 StartIdx = WorkerIdx * ItemsPerWorker;
+			const int32 EndIdx = (WorkerIdx == NumWorkers - 1) ? Num : FMath::Min(Num, StartIdx + ItemsPerWorker);
+
+			MapTasks.Add(UE::Tasks::Launch(TEXT("Map"), [&Data, StartIdx, EndIdx]() -> double
+			{
+				double LocalSum = 0.0;
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					LocalSum += Work(Data.Input[i]);
+				}
+				return LocalSum;
+			}));
+		}
+
+		auto ReduceTask = UE::Tasks::Launch(TEXT("Reduce"), [&MapTasks]() -> double
+		{
+			double Total = 0.0;
+			for (UE::Tasks::TTask<double>& MapTask : MapTasks)
+			{
+				Total += MapTask.GetResult();
+			}
+			return Total;
+		}, UE::Tasks::Prerequisites(MapTasks));
+
+		Data.Output[0] = static_cast<float>(ReduceTask.GetResult());
+		return MapTasks.Num() + 1;
+	}
+
+	static int32 ManualBatching(FBenchmarkData& Data, int32 NumWorkers)
+	{
+		const int32 Num = Data.Input.Num();
+		const int32 BatchSize = FMath::Max(10000, Num / NumWorkers);
+		const int32 NumBatches = FMath::DivideAndRoundUp(Num, BatchSize);
+
+		TArray<TArray<float>> BatchResults;
+		BatchResults.SetNum(NumBatches);
+
+		TArray<UE::Tasks::FTask> Tasks;
+		for (int32 BatchIdx = 0; BatchIdx < NumBatches; BatchIdx++)
+		{
+			const int32 StartIdx = BatchIdx * BatchSize;
+			const int32 EndIdx = FMath::Min(StartIdx + BatchSize, Num);
+
+			Tasks.Add(UE::Tasks::Launch(TEXT("Batch"), [&Data, &BatchResults, BatchIdx, StartIdx, EndIdx]()
+			{
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					BatchResults[BatchIdx].Add(Work(Data.Input[i]));
+				}
+			}));
+		}
+
+		UE::Tasks::Wait(Tasks);
+
+		TArray<float> Merged;
+		Merged.Reserve(Num);
+		for (const TArray<float>& Batch : BatchResults)
+		{
+			Merged.Append(Batch);
+		}
+		Data.Output = MoveTemp(Merged);
+
+		return Tasks.Num();
+	}
+
+	static int32 TaskReturnsArray(FBenchmarkData& Data, int32 NumWorkers)
+	{
+		const int32 Num = Data.Input.Num();
+		const int32 ItemsPerWorker = FMath::Max(1, Num / NumWorkers);
+
+		TArray<UE::Tasks::TTask<TArray<float>>> Tasks;
+		for (int32 WorkerIdx = 0; WorkerIdx < NumWorkers; WorkerIdx++)
+		{
+			const int32 StartIdx = FMath::Min(Num, WorkerIdx * ItemsPerWorker);
+			const int32 EndIdx = (WorkerIdx == NumWorkers - 1) ? Num : FMath::Min(Num, StartIdx + ItemsPerWorker);
+
+			Tasks.Add(UE::Tasks::Launch(TEXT("Worker"), [&Data, StartIdx, EndIdx]() -> TArray<float>
+			{
+				TArray<float> LocalResults;
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					LocalResults.Add(Work(Data.Input[i]));
+				}
+				return LocalResults;
+			}));
+		}
+
+		auto Aggregator = UE::Tasks::Launch(TEXT("Aggregator"), [&Tasks]() -> TArray<float>
+		{
+			TArray<float> AllResults;
+			for (UE::Tasks::TTask<TArray<float>>& Task : Tasks)
+			{
+				AllResults.Append(Task.GetResult());
+			}
+			return AllResults;
+		}, UE::Tasks::Prerequisites(Tasks));
+
+		Data.Output = MoveTemp(Aggregator.GetResult());
+		return Tasks.Num() + 1;
+	}
+
+	static int32 TaskPerItem(FBenchmarkData& Data, int32 /*NumWorkers*/)
+	{
+		TArray<UE::Tasks::FTask> Tasks;
+		Tasks.Reserve(Data.Input.Num());
+
+		for (int32 i = 0; i < Data.Input.Num(); i++)
+		{
+			Tasks.Add(UE::Tasks::Launch(TEXT("Item"), [&Data, i]()
+			{
+				Data.Output[i] = Work(Data.Input[i]);
+			}));
+		}
+
+		UE::Tasks::Wait(Tasks);
+		return Tasks.Num();
+	}
+
+	static int32 LegacyAsyncTask(FBenchmarkData& Data, int32 NumWorkers)
+	{
+		const int32 Num = Data.Input.Num();
+		const int32 ItemsPerWorker = FMath::DivideAndRoundUp(Num, NumWorkers);
+
+		// AsyncTask has no handle to wait on, so count completions and signal an event
+		FEvent* DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+		std::atomic<int32> Remaining{NumWorkers};
+
+		for (int32 WorkerIdx = 0; WorkerIdx < NumWorkers; WorkerIdx++)
+		{
+			const int32 StartIdx = FMath::Min(Num, WorkerIdx * ItemsPerWorker);
+			const int32 EndIdx = FMath::Min(Num, StartIdx + ItemsPerWorker);
+
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [&Data, &Remaining, DoneEvent, StartIdx, EndIdx]()
+			{
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					Data.Output[i] = Work(Data.Input[i]);
+				}
+
+				if (--Remaining == 0)
+				{
+					DoneEvent->Trigger();
+				}
+			});
+		}
+
+		DoneEvent->Wait();
+		FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+		return NumWorkers;
+	}
+
+	static int32 GuidedTransform(FBenchmarkData& Data, int32 NumWorkers)
+	{
+		FParallelChunkPolicy Policy;
+		Policy.NumWorkers = NumWorkers;
+
+		ParallelTransform<float, float>(Data.Input, Data.Output, [](float Value) { return Work(Value); }, Policy);
+		return Policy.ResolveNumWorkers(Data.Input.Num()) - 1;  // Worker 0 is the calling thread
+	}
+
+	static int32 GuidedReduce(FBenchmarkData& Data, int32 NumWorkers)
+	{
+		FParallelChunkPolicy Policy;
+		Policy.NumWorkers = NumWorkers;
+
+		const double Total = ParallelReduce(Data.Input.Num(), 0.0,
+			[&Data](int32 StartIdx, int32 EndIdx, double& LocalSum)
+			{
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					LocalSum += Work(Data.Input[i]);
+				}
+			},
+			[](double A, double B) { return A + B; },
+			Policy);
+
+		Data.Output[0] = static_cast<float>(Total);
+		return Policy.ResolveNumWorkers(Data.Input.Num()) - 1;
+	}
+
+	static int32 Exercise05(FBenchmarkData& Data, int32 /*NumWorkers*/)
+	{
+		return RunExercise05(Data, EFloatKernelPath::Scalar);
+	}
+
+	static int32 Exercise05Vector(FBenchmarkData& Data, int32 /*NumWorkers*/)
+	{
+		return RunExercise05(Data, EFloatKernelPath::Vector);
+	}
+
+	// Registers every kernel with the harness
+	static void RegisterAll(FBenchmarkHarness& Harness)
+	{
+		Harness.AddPattern(TEXT("FanOut"), &FanOut);
+		Harness.AddPattern(TEXT("MapReduce"), &MapReduce);
+		Harness.AddPattern(TEXT("ManualBatching"), &ManualBatching);
+		Harness.AddPattern(TEXT("TaskReturnsArray"), &TaskReturnsArray);
+		Harness.AddPattern(TEXT("TaskPerItem"), &TaskPerItem, 100000, false);
+		Harness.AddPattern(TEXT("LegacyAsyncTask"), &LegacyAsyncTask);
+		Harness.AddPattern(TEXT("GuidedTransform"), &GuidedTransform);
+		Harness.AddPattern(TEXT("GuidedReduce"), &GuidedReduce);
+		Harness.AddPattern(TEXT("Exercise05"), &Exercise05, MAX_int32, false);
+		Harness.AddPattern(TEXT("Exercise05Vector"), &Exercise05Vector, MAX_int32, false);
+	}
+
+private:
+	static int32 RunExercise05(FBenchmarkData& Data, EFloatKernelPath KernelPath)
+	{
+		FExercise05_OptimalBatching_Solution Solution;
+		Data.Output = Solution.ProcessLargeDataset(Data.Input, KernelPath);
+
+		FParallelChunkPolicy Policy;
+		Policy.MinChunkSize = 1024;
+		return Policy.ResolveNumWorkers(Data.Input.Num()) - 1;
+	}
+};
+
+// Runs the full sweep and writes the CSV - called by the commandlet or from a console command
+inline bool RunParallelPatternBenchmarks(const FBenchmarkHarness::FConfig& Config, const FString& CsvPath)
+{
+	UE_LOG(LogTemp, Log, TEXT("=== Parallel Pattern Benchmarks ==="));
+
+	const double LaunchOverheadSeconds = FBenchmarkHarness::MeasureTaskLaunchOverhead();
+	UE_LOG(LogTemp, Log, TEXT("Task launch + retire overhead: %.2f us"), LaunchOverheadSeconds * 1.0e6);
+
+	FBenchmarkHarness Harness;
+	FParallelPatternBenchmarks::RegisterAll(Harness);
+
+	TArray<FBenchmarkResult> Results = Harness.RunAll(Config);
+	return FBenchmarkHarness::SaveCsv(CsvPath, Results, LaunchOverheadSeconds);
+}
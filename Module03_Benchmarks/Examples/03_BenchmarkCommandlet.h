@@ -0,0 +1,121 @@
+// Example 3: Benchmark Commandlet
+// Runs the benchmark suites headless and writes the results as CSV
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Async/Fundamental/Scheduler.h"
+#include "Misc/Paths.h"
+#include "02_ParallelPatternBenchmarks.h"
+#include "05_SmartPointerBenchmarks.h"
+#include "03_BenchmarkCommandlet.generated.h"
+
+/*
+ * A commandlet runs without a world, a viewport or a game thread frame loop, so nothing
+ * competes with the benchmark for cores. Run it from the command line:
+ *
+ *   UnrealEditor-Cmd.exe MyProject.uproject -run=ParallelPatternBenchmark
+ *       -sizes=1e3,1e4,1e5,1e6 -workers=1,2,4,8 -iterations=7 -csv=Saved/Bench.csv
+ *
+ * Every argument is optional - the defaults are FBenchmarkHarness::FConfig.
+ * Sizes accept scientific notation so 1e6 and 1000000 are the same.
+ *
+ * -suite picks what runs: patterns (default), pointers (05_SmartPointerBenchmarks.h)
+ * or all. The pointer suite writes to -pointercsv= and uses -iterations as its run count.
+ * The memory tracker is installed before any suite, so allocation counts are captured.
+ *
+ * Use a Development or Test build. Debug builds disable inlining and FMath intrinsics,
+ * which makes every pattern look compute bound and hides the overhead differences.
+ */
+UCLASS()
+class UParallelPatternBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UParallelPatternBenchmarkCommandlet()
+	{
+		IsClient = false;
+		IsEditor = false;
+		IsServer = false;
+		LogToConsole = true;
+	}
+
+	virtual int32 Main(const FString& Params) override
+	{
+		FBenchmarkHarness::FConfig Config;
+
+		FString Value;
+		if (FParse::Value(*Params, TEXT("-sizes="), Value))
+		{
+			Config.Sizes = ParseIntList(Value);
+		}
+		if (FParse::Value(*Params, TEXT("-workers="), Value))
+		{
+			Config.WorkerCounts = ParseIntList(Value);
+		}
+		FParse::Value(*Params, TEXT("-iterations="), Config.Iterations);
+		FParse::Value(*Params, TEXT("-warmup="), Config.WarmupIterations);
+
+		FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks/ParallelPatterns.csv");
+		FParse::Value(*Params, TEXT("-csv="), CsvPath);
+
+		FString PointerCsvPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks/SmartPointers.csv");
+		FParse::Value(*Params, TEXT("-pointercsv="), PointerCsvPath);
+
+		FString Suite = TEXT("patterns");
+		FParse::Value(*Params, TEXT("-suite="), Suite);
+
+		const bool bRunPatterns = Suite == TEXT("patterns") || Suite == TEXT("all");
+		const bool bRunPointers = Suite == TEXT("pointers") || Suite == TEXT("all");
+		if (!bRunPatterns && !bRunPointers)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ParallelPatternBenchmark: unknown -suite=%s (patterns, pointers or all)"), *Suite);
+			return 1;
+		}
+
+		if (bRunPatterns && (Config.Sizes.Num() == 0 || Config.WorkerCounts.Num() == 0))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ParallelPatternBenchmark: -sizes and -workers need at least one positive value"));
+			return 1;
+		}
+
+		FMemoryTracker::Get().Install();
+
+		bool bSucceeded = true;
+		if (bRunPatterns)
+		{
+			UE_LOG(LogTemp, Log, TEXT("ParallelPatternBenchmark: %d sizes x %d worker counts, %d iterations, %d task workers"),
+				Config.Sizes.Num(), Config.WorkerCounts.Num(), Config.Iterations, LowLevelTasks::FScheduler::Get().GetNumWorkers());
+
+			bSucceeded &= RunParallelPatternBenchmarks(Config, CsvPath);
+		}
+		if (bRunPointers)
+		{
+			bSucceeded &= RunSmartPointerBenchmarks(PointerCsvPath, Config.Iterations);
+		}
+
+		return bSucceeded ? 0 : 1;
+	}
+
+private:
+	// "1e3,1e4,5000" -> {1000, 10000, 5000}. Non-positive entries are dropped.
+	static TArray<int32> ParseIntList(const FString& List)
+	{
+		TArray<FString> Entries;
+		List.ParseIntoArray(Entries, TEXT(","));
+
+		TArray<int32> Values;
+		for (const FString& Entry : Entries)
+		{
+			const double Parsed = FCString::Atod(*Entry.TrimStartAndEnd());
+			if (Parsed >= 1.0 && Parsed <= MAX_int32)
+			{
+				Values.Add(static_cast<int32>(Parsed));
+			}
+		}
+
+		return Values;
+	}
+};
@@ -0,0 +1,406 @@
+// Example 4: Memory Tracking
+// LLM tags per training subsystem and per-frame allocation counts from a counting FMalloc proxy
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/CoreDelegates.h"
+#include "Tasks/Task.h"
+#include "../../Module01_SmartPointers/Examples/04_TWeakPtr.h"
+#include "../../Module01_SmartPointers/Exercises/Exercise02_RealWorld_Solution.h"
+#include <atomic>
+
+/*
+ * Two complementary views of where memory goes:
+ *
+ * 1. BYTES HELD - Low Level Memory tracker (LLM) tags. Every sample subsystem gets a tag
+ *    under "UETraining/": Inventory, Quests, Cache, Observers, Tasks. Allocations made
+ *    inside TRACK_MEMORY_SCOPE(Inventory) are charged to UETraining/Inventory until freed.
+ *    Run with -llm and read them with "stat LLMFULL", -llmcsv, or the Memory Insights
+ *    LLM graph. LLM costs nothing in builds without ENABLE_LOW_LEVEL_MEM_TRACKER.
+ *
+ * 2. ALLOCATIONS PER FRAME - FMemoryTracker::Install() wraps GMalloc in FCountingMalloc,
+ *    which counts every Malloc/Realloc/Free against the subsystem of the innermost
+ *    TRACK_MEMORY_SCOPE on the allocating thread. Counters are swapped out at the end of
+ *    every frame (FCoreDelegates::OnEndFrame), so "Inventory: 312 allocs, 18 KB this
+ *    frame" is available without a profiler attached. It also keeps per-thread counts,
+ *    which the pointer benchmarks (05_SmartPointerBenchmarks.h) use to report allocations
+ *    per operation.
+ *
+ * The scope is per thread: a task launched inside TRACK_MEMORY_SCOPE(Cache) runs
+ * untracked unless its body opens its own scope.
+ *
+ * The Module 1 and 2 systems stay free of tracking code - scopes are opened around the
+ * calls into them (see TrackCallSites below), so only this module depends on the tracker.
+ *
+ * Install() as early as possible (module startup, or a commandlet's Main), on the game
+ * thread. Allocations made before it aren't counted; the proxy is never removed.
+ *
+ * Tags are created by name on first use (LLM_SCOPE_BYNAME), so there is no tag object to
+ * declare or define in a .cpp.
+ */
+
+enum class ETrackedSubsystem : uint8
+{
+	Untracked,
+	Inventory,
+	Quests,
+	Cache,
+	Observers,
+	Tasks,
+	Count
+};
+
+inline const TCHAR* LexToString(ETrackedSubsystem Subsystem)
+{
+	switch (Subsystem)
+	{
+	case ETrackedSubsystem::Inventory: return TEXT("Inventory");
+	case ETrackedSubsystem::Quests:    return TEXT("Quests");
+	case ETrackedSubsystem::Cache:     return TEXT("Cache");
+	case ETrackedSubsystem::Observers: return TEXT("Observers");
+	case ETrackedSubsystem::Tasks:     return TEXT("Tasks");
+	default:                           return TEXT("Untracked");
+	}
+}
+
+// Innermost tracked subsystem on this thread - trivially constructed, safe to read inside malloc
+inline ETrackedSubsystem& CurrentTrackedSubsystem()
+{
+	static thread_local ETrackedSubsystem Current = ETrackedSubsystem::Untracked;
+	return Current;
+}
+
+class FTrackedMemoryScope
+{
+public:
+	explicit FTrackedMemoryScope(ETrackedSubsystem Subsystem)
+		: Previous(CurrentTrackedSubsystem())
+	{
+		CurrentTrackedSubsystem() = Subsystem;
+	}
+
+	~FTrackedMemoryScope()
+	{
+		CurrentTrackedSubsystem() = Previous;
+	}
+
+	FTrackedMemoryScope(const FTrackedMemoryScope&) = delete;
+	FTrackedMemoryScope& operator=(const FTrackedMemoryScope&) = delete;
+
+private:
+	ETrackedSubsystem Previous;
+};
+
+// Charges allocations in the enclosing C++ scope to the LLM tag UETraining/<Subsystem>
+// and to the per-frame counters
+#define TRACK_MEMORY_SCOPE(Subsystem) \
+	LLM_SCOPE_BYNAME(TEXT("UETraining/") TEXT(#Subsystem)); \
+	FTrackedMemoryScope PREPROCESSOR_JOIN(TrackedMemoryScope_, __LINE__)(ETrackedSubsystem::Subsystem)
+
+struct FAllocationStats
+{
+	int64 NumAllocs = 0;       // Malloc, and Realloc that moved or grew a block
+	int64 NumFrees = 0;
+	int64 BytesAllocated = 0;  // Requested bytes, before the allocator rounds them up
+};
+
+// Forwards to the real allocator and counts. Installed by FMemoryTracker.
+class FCountingMalloc final : public FMalloc
+{
+public:
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FCounters
+	{
+		std::atomic<int64> NumAllocs{0};
+		std::atomic<int64> NumFrees{0};
+		std::atomic<int64> BytesAllocated{0};
+	};
+
+	explicit FCountingMalloc(FMalloc* InInner)
+		: Inner(InInner)
+	{
+	}
+
+	// Counters since the last TakeCounts, per subsystem - any thread
+	FAllocationStats TakeCounts(ETrackedSubsystem Subsystem)
+	{
+		FCounters& Slot = Counters[static_cast<int32>(Subsystem)];
+
+		FAllocationStats Stats;
+		Stats.NumAllocs = Slot.NumAllocs.exchange(0, std::memory_order_relaxed);
+		Stats.NumFrees = Slot.NumFrees.exchange(0, std::memory_order_relaxed);
+		Stats.BytesAllocated = Slot.BytesAllocated.exchange(0, std::memory_order_relaxed);
+		return Stats;
+	}
+
+	// Running totals for the calling thread only - never reset
+	static FAllocationStats& ThreadCounts()
+	{
+		static thread_local FAllocationStats Counts;
+		return Counts;
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		void* Result = Inner->Malloc(Count, Alignment);
+		RecordAlloc(Count);
+		return Result;
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		void* Result = Inner->TryMalloc(Count, Alignment);
+		if (Result)
+		{
+			RecordAlloc(Count);
+		}
+		return Result;
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		void* Result = Inner->Realloc(Original, Count, Alignment);
+		if (Count == 0)
+		{
+			RecordFree(Original);
+		}
+		else if (Result != Original || !Original)
+		{
+			RecordAlloc(Count);  // In-place shrinks and grows aren't allocations
+			RecordFree(Original);
+		}
+		return Result;
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		void* Result = Inner->TryRealloc(Original, Count, Alignment);
+		if (Count == 0)
+		{
+			RecordFree(Original);
+		}
+		else if (Result && (Result != Original || !Original))
+		{
+			RecordAlloc(Count);
+			RecordFree(Original);
+		}
+		return Result;
+	}
+
+	virtual void Free(void* Original) override
+	{
+		Inner->Free(Original);
+		RecordFree(Original);
+	}
+
+	// Everything else goes straight to the real allocator
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+	virtual void UpdateStats() override { Inner->UpdateStats(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+private:
+	void RecordAlloc(SIZE_T Count)
+	{
+		FCounters& Slot = Counters[static_cast<int32>(CurrentTrackedSubsystem())];
+		Slot.NumAllocs.fetch_add(1, std::memory_order_relaxed);
+		Slot.BytesAllocated.fetch_add(static_cast<int64>(Count), std::memory_order_relaxed);
+
+		FAllocationStats& Thread = ThreadCounts();
+		Thread.NumAllocs++;
+		Thread.BytesAllocated += static_cast<int64>(Count);
+	}
+
+	void RecordFree(void* Original)
+	{
+		if (Original)
+		{
+			Counters[static_cast<int32>(CurrentTrackedSubsystem())].NumFrees.fetch_add(1, std::memory_order_relaxed);
+			ThreadCounts().NumFrees++;
+		}
+	}
+
+	FMalloc* Inner;
+	FCounters Counters[static_cast<int32>(ETrackedSubsystem::Count)];
+};
+
+class FMemoryTracker
+{
+public:
+	static FMemoryTracker& Get()
+	{
+		static FMemoryTracker* Instance = new FMemoryTracker();
+		return *Instance;
+	}
+
+	// Wraps GMalloc once. Game thread, as early as possible.
+	void Install()
+	{
+		check(IsInGameThread());
+		if (Proxy)
+		{
+			return;
+		}
+
+		Proxy = new FCountingMalloc(GMalloc);  // Leaked with the tracker - frees keep going through it
+		GMalloc = Proxy;
+
+		FCoreDelegates::OnEndFrame.AddRaw(this, &FMemoryTracker::EndFrame);
+		UE_LOG(LogTemp, Log, TEXT("MemoryTracker: counting allocations through %s"), Proxy->GetDescriptiveName());
+	}
+
+	bool IsInstalled() const { return Proxy != nullptr; }
+
+	// What each subsystem allocated during the last complete frame - game thread
+	const FAllocationStats& GetLastFrame(ETrackedSubsystem Subsystem) const
+	{
+		return LastFrame[static_cast<int32>(Subsystem)];
+	}
+
+	// Highest per-frame allocation count seen so far
+	int64 GetPeakAllocsPerFrame(ETrackedSubsystem Subsystem) const
+	{
+		return PeakAllocsPerFrame[static_cast<int32>(Subsystem)];
+	}
+
+	// Allocations made by the calling thread since Install()
+	static FAllocationStats GetThreadCounts()
+	{
+		return FCountingMalloc::ThreadCounts();
+	}
+
+	// Called from OnEndFrame; call it yourself where there is no frame loop (commandlets)
+	void EndFrame()
+	{
+		if (!Proxy)
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < static_cast<int32>(ETrackedSubsystem::Count); Index++)
+		{
+			LastFrame[Index] = Proxy->TakeCounts(static_cast<ETrackedSubsystem>(Index));
+			PeakAllocsPerFrame[Index] = FMath::Max(PeakAllocsPerFrame[Index], LastFrame[Index].NumAllocs);
+		}
+		NumFrames++;
+	}
+
+	void LogLastFrame() const
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Allocations, frame %llu ==="), NumFrames);
+
+		for (int32 Index = 0; Index < static_cast<int32>(ETrackedSubsystem::Count); Index++)
+		{
+			const FAllocationStats& Stats = LastFrame[Index];
+			UE_LOG(LogTemp, Log, TEXT("  %-10s %8lld allocs %8lld frees %10.1f KB  (peak %lld allocs/frame)"),
+				LexToString(static_cast<ETrackedSubsystem>(Index)), Stats.NumAllocs, Stats.NumFrees,
+				Stats.BytesAllocated / 1024.0, PeakAllocsPerFrame[Index]);
+		}
+	}
+
+private:
+	FMemoryTracker() = default;
+
+	FCountingMalloc* Proxy = nullptr;
+	FAllocationStats LastFrame[static_cast<int32>(ETrackedSubsystem::Count)];
+	int64 PeakAllocsPerFrame[static_cast<int32>(ETrackedSubsystem::Count)] = {};
+	uint64 NumFrames = 0;
+};
+
+// Example usage
+class FMemoryTrackingExamples
+{
+public:
+	// Example 1: Tag a subsystem's allocations, read them back next frame
+	void TagSubsystem()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Memory Tracking: Tagged Scope ==="));
+
+		FMemoryTracker::Get().Install();
+
+		TArray<TSharedPtr<FString>> Items;
+		{
+			TRACK_MEMORY_SCOPE(Inventory);
+			for (int32 i = 0; i < 100; i++)
+			{
+				Items.Add(MakeShared<FString>(FString::Printf(TEXT("Item_%d"), i)));
+			}
+		}
+
+		FMemoryTracker::Get().EndFrame();  // The engine does this at the end of every frame
+		const FAllocationStats& Inventory = FMemoryTracker::Get().GetLastFrame(ETrackedSubsystem::Inventory);
+		UE_LOG(LogTemp, Log, TEXT("Inventory: %lld allocations, %lld bytes for 100 items"), Inventory.NumAllocs, Inventory.BytesAllocated);
+	}
+
+	// Example 2: Tasks need their own scope - the tag is per thread
+	void TagTaskBody()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Memory Tracking: Task Scope ==="));
+
+		UE::Tasks::Launch(TEXT("BuildCache"), []()
+		{
+			TRACK_MEMORY_SCOPE(Cache);  // Charged to Cache on whichever worker runs this
+
+			TArray<int32> Table;
+			Table.SetNum(4096);
+		}).Wait();
+	}
+
+	// Example 3: Charge the Module 1 systems from their call sites
+	void TrackCallSites()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Memory Tracking: Call Sites ==="));
+
+		FMemoryTracker::Get().Install();
+
+		FInventorySystem_Sol Inventory;
+		FQuestManager_Sol Quests;
+		FResourceCache Cache;
+		TConcurrentObserverList<FResource> Observers;
+
+		TSharedPtr<FResource> Texture;
+		{
+			TRACK_MEMORY_SCOPE(Inventory);
+			Inventory.AddItem(TEXT("Sword"), 100, 5.0f);
+			Inventory.AddItem(TEXT("Shield"), 80, 8.0f);
+		}
+		{
+			TRACK_MEMORY_SCOPE(Quests);
+			Quests.StartQuest(TEXT("Slay the Dragon"));
+		}
+		{
+			// Only the caller's side - the load itself runs on a worker, outside this scope
+			TRACK_MEMORY_SCOPE(Cache);
+			Texture = Cache.GetOrLoad(TEXT("Texture_Rock"));
+		}
+		{
+			TRACK_MEMORY_SCOPE(Observers);  // Every Add copies the observer array
+			Observers.Add(Texture);
+		}
+
+		FMemoryTracker::Get().EndFrame();
+		FMemoryTracker::Get().LogLastFrame();
+	}
+
+	// Example 4: WRONG - expecting the scope to follow the work into a task
+	void ScopeAcrossThreadsAntiPattern()
+	{
+		/* DON'T DO THIS:
+		TRACK_MEMORY_SCOPE(Quests);
+		UE::Tasks::Launch(TEXT("Rebuild"), [] { RebuildQuestGraph(); });   // Runs untracked on a worker
+		*/
+
+		// DO THIS:
+		// UE::Tasks::Launch(TEXT("Rebuild"), [] { TRACK_MEMORY_SCOPE(Quests); RebuildQuestGraph(); });
+	}
+};
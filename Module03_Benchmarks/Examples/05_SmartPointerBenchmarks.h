@@ -0,0 +1,394 @@
+// Example 5: Smart Pointer Benchmarks
+// Measured costs behind the Module 1 pointer guidelines - time and allocations per operation
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "04_MemoryTracking.h"
+#include <atomic>
+
+/*
+ * Module 1 states its guidelines as rules of thumb: "TUniquePtr is cheaper than
+ * TSharedPtr", "MakeShared saves an allocation", "NotThreadSafe avoids atomics",
+ * "Pin() is not free". This suite measures each one:
+ *
+ *   SharedCopy_ThreadSafe / _NotThreadSafe   - copy + destroy a TSharedPtr (refcount inc/dec)
+ *   SharedCopy_ThreadSafe_Contended          - the same on 4 workers sharing one object
+ *   Create_MakeShared / _New / _NotThreadSafe / _MakeUnique
+ *                                            - create + destroy one object
+ *   Pin_ThreadSafe / _NotThreadSafe / _Expired
+ *                                            - TWeakPtr::Pin() on a live (or dead) object
+ *   ArrayGrow_Unique / _Shared               - Add() one pointer at a time, no Reserve
+ *   ArrayRemoveFront_Unique / _Shared        - RemoveAt(0), shifting every other element
+ *
+ * Each benchmark runs OpsPerRun operations per run; the median over the runs is reported
+ * in nanoseconds per operation. With FMemoryTracker installed (04_MemoryTracking.h) the
+ * allocations and bytes requested per operation are reported too - measured on the
+ * benchmark thread only, so other threads don't pollute them.
+ *
+ * ReportFootprints() separately lists what one object costs to hold through each pointer
+ * type: the handle size, heap allocations per object, and heap bytes per object
+ * (payload + reference controller). This is the "bytes held per pointer type" table.
+ *
+ * Read the numbers relative to each other. Absolute ns depend on the CPU, the allocator
+ * and the build configuration - use Development or Test, never Debug.
+ */
+
+struct FMicroBenchmarkResult
+{
+	FString Name;
+	int32 OpsPerRun = 0;
+	int32 Runs = 0;
+	double MedianNsPerOp = 0.0;
+	double MinNsPerOp = 0.0;
+	double AllocsPerOp = -1.0;  // -1 = tracker not installed
+	double BytesPerOp = -1.0;
+};
+
+struct FPointerFootprint
+{
+	FString PointerType;
+	int32 HandleBytes = 0;
+	double AllocsPerObject = -1.0;
+	double HeapBytesPerObject = -1.0;
+};
+
+class FSmartPointerBenchmarks
+{
+public:
+	// 64 bytes - a typical small gameplay struct
+	struct FPayload
+	{
+		int32 Values[16] = {};
+	};
+
+	static constexpr int32 OpsPerRun = 100000;
+
+	static TArray<FMicroBenchmarkResult> RunAll(int32 Runs = 7)
+	{
+		TArray<FMicroBenchmarkResult> Results;
+
+		// Refcount traffic
+		Results.Add(Measure(TEXT("SharedCopy_ThreadSafe"), Runs, &SharedCopy<ESPMode::ThreadSafe>));
+		Results.Add(Measure(TEXT("SharedCopy_NotThreadSafe"), Runs, &SharedCopy<ESPMode::NotThreadSafe>));
+		Results.Add(Measure(TEXT("SharedCopy_ThreadSafe_Contended"), Runs, &SharedCopyContended));
+
+		// Creation
+		Results.Add(Measure(TEXT("Create_MakeShared"), Runs, &CreateMakeShared<ESPMode::ThreadSafe>));
+		Results.Add(Measure(TEXT("Create_MakeShared_NotThreadSafe"), Runs, &CreateMakeShared<ESPMode::NotThreadSafe>));
+		Results.Add(Measure(TEXT("Create_New"), Runs, &CreateNew));
+		Results.Add(Measure(TEXT("Create_MakeUnique"), Runs, &CreateMakeUnique));
+
+		// Weak access
+		Results.Add(Measure(TEXT("Pin_ThreadSafe"), Runs, &Pin<ESPMode::ThreadSafe>));
+		Results.Add(Measure(TEXT("Pin_NotThreadSafe"), Runs, &Pin<ESPMode::NotThreadSafe>));
+		Results.Add(Measure(TEXT("Pin_Expired"), Runs, &PinExpired));
+
+		// Containers - both pointer types relocate with a memcpy; the difference is in destruction
+		Results.Add(Measure(TEXT("ArrayGrow_Unique"), Runs, &ArrayGrow<TUniquePtr<FPayload>>));
+		Results.Add(Measure(TEXT("ArrayGrow_Shared"), Runs, &ArrayGrow<TSharedPtr<FPayload>>));
+		Results.Add(Measure(TEXT("ArrayRemoveFront_Unique"), Runs, &ArrayRemoveFront<TUniquePtr<FPayload>>));
+		Results.Add(Measure(TEXT("ArrayRemoveFront_Shared"), Runs, &ArrayRemoveFront<TSharedPtr<FPayload>>));
+
+		return Results;
+	}
+
+	static TArray<FPointerFootprint> ReportFootprints()
+	{
+		constexpr int32 NumObjects = 1000;
+		TArray<FPointerFootprint> Footprints;
+
+		Footprints.Add(MeasureFootprint(TEXT("FPayload*"), sizeof(FPayload*), NumObjects, [](int32 Num)
+		{
+			TArray<TUniquePtr<FPayload>> Objects;  // Raw new, owned by TUniquePtr only to free it
+			Objects.Reserve(Num);
+			return [Num, Objects = MoveTemp(Objects)]() mutable
+			{
+				for (int32 i = 0; i < Num; i++) { Objects.Emplace(new FPayload()); }
+			};
+		}));
+		Footprints.Add(MeasureFootprint(TEXT("TUniquePtr (MakeUnique)"), sizeof(TUniquePtr<FPayload>), NumObjects, [](int32 Num)
+		{
+			TArray<TUniquePtr<FPayload>> Objects;
+			Objects.Reserve(Num);
+			return [Num, Objects = MoveTemp(Objects)]() mutable
+			{
+				for (int32 i = 0; i < Num; i++) { Objects.Add(MakeUnique<FPayload>()); }
+			};
+		}));
+		Footprints.Add(MeasureFootprint(TEXT("TSharedPtr (MakeShared)"), sizeof(TSharedPtr<FPayload>), NumObjects, [](int32 Num)
+		{
+			TArray<TSharedPtr<FPayload>> Objects;
+			Objects.Reserve(Num);
+			return [Num, Objects = MoveTemp(Objects)]() mutable
+			{
+				for (int32 i = 0; i < Num; i++) { Objects.Add(MakeShared<FPayload>()); }
+			};
+		}));
+		Footprints.Add(MeasureFootprint(TEXT("TSharedPtr (new)"), sizeof(TSharedPtr<FPayload>), NumObjects, [](int32 Num)
+		{
+			TArray<TSharedPtr<FPayload>> Objects;
+			Objects.Reserve(Num);
+			return [Num, Objects = MoveTemp(Objects)]() mutable
+			{
+				for (int32 i = 0; i < Num; i++) { Objects.Add(TSharedPtr<FPayload>(new FPayload())); }
+			};
+		}));
+
+		// A weak pointer allocates nothing - it shares the controller of the shared pointer
+		FPointerFootprint Weak;
+		Weak.PointerType = TEXT("TWeakPtr");
+		Weak.HandleBytes = sizeof(TWeakPtr<FPayload>);
+		Weak.AllocsPerObject = 0.0;
+		Weak.HeapBytesPerObject = 0.0;
+		Footprints.Add(Weak);
+
+		return Footprints;
+	}
+
+	static void LogResults(const TArray<FMicroBenchmarkResult>& Results, const TArray<FPointerFootprint>& Footprints)
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Smart Pointer Benchmarks (%d ops per run) ==="), OpsPerRun);
+		for (const FMicroBenchmarkResult& Result : Results)
+		{
+			UE_LOG(LogTemp, Log, TEXT("  %-34s %8.2f ns/op  %6.2f allocs/op  %8.1f bytes/op"),
+				*Result.Name, Result.MedianNsPerOp, Result.AllocsPerOp, Result.BytesPerOp);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("=== Bytes held per %d-byte object ==="), static_cast<int32>(sizeof(FPayload)));
+		for (const FPointerFootprint& Footprint : Footprints)
+		{
+			UE_LOG(LogTemp, Log, TEXT("  %-30s handle %2d bytes  %4.2f allocs  %6.1f heap bytes"),
+				*Footprint.PointerType, Footprint.HandleBytes, Footprint.AllocsPerObject, Footprint.HeapBytesPerObject);
+		}
+	}
+
+	static FString ToCsv(const TArray<FMicroBenchmarkResult>& Results, const TArray<FPointerFootprint>& Footprints)
+	{
+		FString Csv = TEXT("Benchmark,OpsPerRun,Runs,MedianNsPerOp,MinNsPerOp,AllocsPerOp,BytesPerOp\n");
+		for (const FMicroBenchmarkResult& Result : Results)
+		{
+			Csv += FString::Printf(TEXT("%s,%d,%d,%.3f,%.3f,%.3f,%.1f\n"), *Result.Name, Result.OpsPerRun, Result.Runs,
+				Result.MedianNsPerOp, Result.MinNsPerOp, Result.AllocsPerOp, Result.BytesPerOp);
+		}
+
+		Csv += TEXT("\nPointerType,HandleBytes,AllocsPerObject,HeapBytesPerObject\n");
+		for (const FPointerFootprint& Footprint : Footprints)
+		{
+			Csv += FString::Printf(TEXT("%s,%d,%.3f,%.1f\n"), *Footprint.PointerType, Footprint.HandleBytes,
+				Footprint.AllocsPerObject, Footprint.HeapBytesPerObject);
+		}
+		return Csv;
+	}
+
+private:
+	// Keeps the optimizer from deleting benchmark loops whose results are unused
+	static void Consume(const void* Value)
+	{
+		static const void* volatile Sink = nullptr;
+		Sink = Value;
+	}
+
+	using FBenchmarkFunc = void (*)();
+
+	static FMicroBenchmarkResult Measure(const TCHAR* Name, int32 Runs, FBenchmarkFunc Func)
+	{
+		Func();  // Warmup - pool growth, page faults, TLS caches
+
+		TArray<double> Samples;
+		const FAllocationStats Before = FMemoryTracker::GetThreadCounts();
+
+		for (int32 Run = 0; Run < FMath::Max(1, Runs); Run++)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Func();
+			Samples.Add((FPlatformTime::Seconds() - Start) * 1.0e9 / OpsPerRun);
+		}
+
+		const FAllocationStats After = FMemoryTracker::GetThreadCounts();
+		Samples.Sort();
+
+		FMicroBenchmarkResult Result;
+		Result.Name = Name;
+		Result.OpsPerRun = OpsPerRun;
+		Result.Runs = Samples.Num();
+		Result.MedianNsPerOp = Samples[Samples.Num() / 2];
+		Result.MinNsPerOp = Samples[0];
+
+		if (FMemoryTracker::Get().IsInstalled())
+		{
+			const double TotalOps = static_cast<double>(OpsPerRun) * Samples.Num();
+			Result.AllocsPerOp = (After.NumAllocs - Before.NumAllocs) / TotalOps;
+			Result.BytesPerOp = (After.BytesAllocated - Before.BytesAllocated) / TotalOps;
+		}
+		return Result;
+	}
+
+	// MakeFill(Num) prepares the container outside the measurement and returns the fill step
+	template<typename MakeFillType>
+	static FPointerFootprint MeasureFootprint(const TCHAR* PointerType, int32 HandleBytes, int32 NumObjects, MakeFillType&& MakeFill)
+	{
+		FPointerFootprint Footprint;
+		Footprint.PointerType = PointerType;
+		Footprint.HandleBytes = HandleBytes;
+
+		auto Fill = MakeFill(NumObjects);
+		const FAllocationStats Before = FMemoryTracker::GetThreadCounts();
+		Fill();
+		const FAllocationStats After = FMemoryTracker::GetThreadCounts();
+
+		if (FMemoryTracker::Get().IsInstalled())
+		{
+			Footprint.AllocsPerObject = static_cast<double>(After.NumAllocs - Before.NumAllocs) / NumObjects;
+			Footprint.HeapBytesPerObject = static_cast<double>(After.BytesAllocated - Before.BytesAllocated) / NumObjects;
+		}
+		return Footprint;
+	}
+
+	template<ESPMode Mode>
+	static void SharedCopy()
+	{
+		const TSharedPtr<FPayload, Mode> Source = MakeShared<FPayload, Mode>();
+		for (int32 i = 0; i < OpsPerRun; i++)
+		{
+			TSharedPtr<FPayload, Mode> Copy = Source;  // Increment, then decrement at the end of the iteration
+			Consume(&Copy);
+		}
+	}
+
+	// Every worker increments and decrements the same controller - the cache line bounces between cores
+	static void SharedCopyContended()
+	{
+		constexpr int32 NumWorkers = 4;
+		const TSharedPtr<FPayload> Source = MakeShared<FPayload>();
+
+		ParallelFor(NumWorkers, [&Source](int32)
+		{
+			for (int32 i = 0; i < OpsPerRun / NumWorkers; i++)
+			{
+				TSharedPtr<FPayload> Copy = Source;
+				Consume(&Copy);
+			}
+		});
+	}
+
+	template<ESPMode Mode>
+	static void CreateMakeShared()
+	{
+		for (int32 i = 0; i < OpsPerRun; i++)
+		{
+			TSharedPtr<FPayload, Mode> Object = MakeShared<FPayload, Mode>();  // One block: object + controller
+			Consume(Object.Get());
+		}
+	}
+
+	static void CreateNew()
+	{
+		for (int32 i = 0; i < OpsPerRun; i++)
+		{
+			TSharedPtr<FPayload> Object(new FPayload());  // Two blocks: object, then controller
+			Consume(Object.Get());
+		}
+	}
+
+	static void CreateMakeUnique()
+	{
+		for (int32 i = 0; i < OpsPerRun; i++)
+		{
+			TUniquePtr<FPayload> Object = MakeUnique<FPayload>();  // One block, no controller
+			Consume(Object.Get());
+		}
+	}
+
+	template<ESPMode Mode>
+	static void Pin()
+	{
+		const TSharedPtr<FPayload, Mode> Source = MakeShared<FPayload, Mode>();
+		const TWeakPtr<FPayload, Mode> Weak = Source;
+		for (int32 i = 0; i < OpsPerRun; i++)
+		{
+			TSharedPtr<FPayload, Mode> Pinned = Weak.Pin();  // Compare-exchange loop on the strong count
+			Consume(Pinned.Get());
+		}
+	}
+
+	static void PinExpired()
+	{
+		TWeakPtr<FPayload> Weak;
+		{
+			const TSharedPtr<FPayload> Source = MakeShared<FPayload>();
+			Weak = Source;
+		}
+		for (int32 i = 0; i < OpsPerRun; i++)
+		{
+			TSharedPtr<FPayload> Pinned = Weak.Pin();  // Reads a zero strong count and returns null
+			Consume(Pinned.Get());
+		}
+	}
+
+	template<typename PointerType>
+	static PointerType MakePointer()
+	{
+		if constexpr (std::is_same_v<PointerType, TUniquePtr<FPayload>>)
+		{
+			return MakeUnique<FPayload>();
+		}
+		else
+		{
+			return MakeShared<FPayload>();
+		}
+	}
+
+	// Grows by doubling - each reallocation relocates every pointer so far
+	template<typename PointerType>
+	static void ArrayGrow()
+	{
+		TArray<PointerType> Array;
+		for (int32 i = 0; i < OpsPerRun; i++)
+		{
+			Array.Add(MakePointer<PointerType>());
+		}
+		Consume(Array.GetData());
+	}
+
+	// Shifts the remaining elements down on every removal - O(N^2) moves, on a small array
+	template<typename PointerType>
+	static void ArrayRemoveFront()
+	{
+		constexpr int32 NumElements = 1000;
+		TArray<PointerType> Array;
+		for (int32 Batch = 0; Batch < OpsPerRun / NumElements; Batch++)
+		{
+			for (int32 i = 0; i < NumElements; i++)
+			{
+				Array.Add(MakePointer<PointerType>());
+			}
+			while (Array.Num() > 0)
+			{
+				Array.RemoveAt(0);
+			}
+		}
+		Consume(Array.GetData());
+	}
+};
+
+// Runs the suite, logs it and writes the CSV - called by the commandlet (-suite=pointers)
+inline bool RunSmartPointerBenchmarks(const FString& CsvPath, int32 Runs = 7)
+{
+	UE_LOG(LogTemp, Log, TEXT("=== Smart Pointer Benchmarks ==="));
+
+	if (!FMemoryTracker::Get().IsInstalled())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MemoryTracker not installed - allocation columns will be -1"));
+	}
+
+	const TArray<FMicroBenchmarkResult> Results = FSmartPointerBenchmarks::RunAll(Runs);
+	const TArray<FPointerFootprint> Footprints = FSmartPointerBenchmarks::ReportFootprints();
+	FSmartPointerBenchmarks::LogResults(Results, Footprints);
+
+	const bool bSaved = FFileHelper::SaveStringToFile(FSmartPointerBenchmarks::ToCsv(Results, Footprints), *CsvPath);
+	UE_LOG(LogTemp, Log, TEXT("Smart pointer CSV %s: %s"), bSaved ? TEXT("written") : TEXT("FAILED"), *CsvPath);
+	return bSaved;
+}
@@ -0,0 +1,47 @@
+// Exercise 1: Measure the Best Batch Size
+// Use the benchmark harness to pick MinChunkSize from data instead of guessing
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Examples/01_BenchmarkHarness.h"
+#include "../../Module02_TaskSystem/Examples/07_ParallelChunking.h"
+
+/*
+ * EXERCISE 1: Sweep MinChunkSize
+ *
+ * ParallelTransform defaults to MinChunkSize = 1024. That is a guess - the right value
+ * depends on how expensive one item is. Measure it.
+ *
+ * The workload below is deliberately cheap (one multiply-add per element), so small
+ * chunks should lose to launch and claim overhead.
+ */
+
+class FExercise01_MeasureBatchSize
+{
+public:
+	static float CheapWork(float Value)
+	{
+		return Value * 1.5f + 2.0f;
+	}
+
+	void RunSweep()
+	{
+		// TODO: Build an FBenchmarkHarness and register one pattern per chunk size
+		// 1. Chunk sizes to try: 64, 256, 1024, 4096, 16384, 65536
+		// 2. Each pattern runs ParallelTransform over Data.Input into Data.Output
+		//    using CheapWork and an FParallelChunkPolicy with that MinChunkSize
+		//    and NumWorkers set from the harness argument
+		// 3. Return the number of tasks launched (ResolveNumWorkers - 1, the caller is worker 0)
+		// 4. Run with Sizes = {1000000} and WorkerCounts = {1, 4, 8}
+		// 5. Log the chunk size with the highest items/sec at 8 workers
+		// 6. Save the results to Saved/Benchmarks/ChunkSweep.csv
+
+		// Hint: Capture the chunk size by value in the pattern lambda
+		// Hint: Pattern names must be unique - put the chunk size in the name
+	}
+
+	// TODO: Answer after running the sweep
+	// Q1: Every chunk size launches the same number of tasks - why is the smallest one slower?
+	// Q2: Would the best chunk size go up or down if CheapWork called FMath::Sin?
+};
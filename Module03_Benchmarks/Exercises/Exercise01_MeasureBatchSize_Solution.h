@@ -0,0 +1,75 @@
+// Exercise 1 Solution: Measure the Best Batch Size
+// Sweeps MinChunkSize with the benchmark harness
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Paths.h"
+#include "../Examples/01_BenchmarkHarness.h"
+#include "../../Module02_TaskSystem/Examples/07_ParallelChunking.h"
+
+/*
+ * SOLUTION 1: Sweep MinChunkSize
+ */
+
+class FExercise01_MeasureBatchSize_Solution
+{
+public:
+	static float CheapWork(float Value)
+	{
+		return Value * 1.5f + 2.0f;
+	}
+
+	void RunSweep()
+	{
+		UE_LOG(LogTemp, Log, TEXT("=== Exercise: MinChunkSize Sweep ==="));
+
+		const TArray<int32> ChunkSizes = {64, 256, 1024, 4096, 16384, 65536};
+
+		FBenchmarkHarness Harness;
+		for (int32 ChunkSize : ChunkSizes)
+		{
+			// One pattern per chunk size - the name is how results are told apart
+			Harness.AddPattern(*FString::Printf(TEXT("Chunk%d"), ChunkSize), [ChunkSize](FBenchmarkData& Data, int32 NumWorkers)
+			{
+				FParallelChunkPolicy Policy;
+				Policy.MinChunkSize = ChunkSize;
+				Policy.NumWorkers = NumWorkers;
+
+				ParallelTransform<float, float>(Data.Input, Data.Output, &CheapWork, Policy);
+				return Policy.ResolveNumWorkers(Data.Input.Num()) - 1;
+			});
+		}
+
+		FBenchmarkHarness::FConfig Config;
+		Config.Sizes = {1000000};
+		Config.WorkerCounts = {1, 4, 8};
+
+		TArray<FBenchmarkResult> Results = Harness.RunAll(Config);
+
+		// Best throughput at the highest worker count
+		const FBenchmarkResult* Best = nullptr;
+		for (const FBenchmarkResult& Result : Results)
+		{
+			if (Result.NumWorkers == 8 && (!Best || Result.GetItemsPerSecond() > Best->GetItemsPerSecond()))
+			{
+				Best = &Result;
+			}
+		}
+
+		if (Best)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Best at 8 workers: %s (%.0f items/s, efficiency %.2f)"),
+				*Best->Pattern, Best->GetItemsPerSecond(), Best->ScalingEfficiency);
+		}
+
+		FBenchmarkHarness::SaveCsv(FPaths::ProjectSavedDir() / TEXT("Benchmarks/ChunkSweep.csv"),
+			Results, FBenchmarkHarness::MeasureTaskLaunchOverhead());
+	}
+
+	// A1: Task launch cost is the same, but small chunks mean many more claims. Every claim
+	//     is a CAS on one shared cache line, so with cheap items the workers spend their time
+	//     bouncing that line between cores instead of computing.
+	// A2: Down. More expensive items amortize the claim cost over fewer elements, and
+	//     smaller chunks balance the tail better.
+};